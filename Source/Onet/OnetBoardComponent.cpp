@@ -2,9 +2,32 @@
 
 
 #include "OnetBoardComponent.h"
+#include "OnetBoardSnapshot.h"
+#include "OnetBoardSolver.h"
+#include "Async/Async.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
+namespace
+{
+	// Merge the notifications of one component operation (see UOnetBoardComponent::BeginNotificationBatch).
+	struct FNotificationBatchScope
+	{
+		UOnetBoardComponent& Board;
+
+		explicit FNotificationBatchScope(UOnetBoardComponent& InBoard)
+			: Board(InBoard)
+		{
+			Board.BeginNotificationBatch();
+		}
+
+		~FNotificationBatchScope()
+		{
+			Board.EndNotificationBatch();
+		}
+	};
+}
+
 UOnetBoardComponent::UOnetBoardComponent()
 {
 	// Set tick to false. We will use event-driven updates instead.
@@ -20,161 +43,292 @@ UOnetBoardComponent::UOnetBoardComponent()
  */
 void UOnetBoardComponent::InitializeBoard(const int32 InWidth, const int32 InHeight, const int32 InNumTileTypes)
 {
-	// Ensure minimum logical dimensions of 1x1
-	Width = FMath::Max(1, InWidth);
-	Height = FMath::Max(1, InHeight);
+	// The new board, a possible auto shuffle and the reset selection/hint reach listeners as one update.
+	FNotificationBatchScope NotificationBatch(*this);
 
-	int32 NumCells = Width * Height;
+	SyncCoreRules();
+	const int32 NumUniqueTypes = Core.Initialize(InWidth, InHeight, InNumTileTypes);
+	MarkBoardChanged();
 
-	// Onet game requires pairs, so total cells should be even.
-	// For MVP, if odd, we shrink the board by one row to make it even.
-	if (NumCells % 2 != 0)
-	{
-		UE_LOG(LogTemp, Error, TEXT("NumCells must be a multiple of 2. Shrinking height by 1 for MVP."));
-		Height = FMath::Max(1, Height - 1);
-		NumCells = Width * Height;
-	}
+	// Reset selection state
+	bHasFirstSelection = false;
+	FirstSelection = FIntPoint(-1, -1);
+	ResetSelectionReach();
 
-	// Set physical dimensions with padding (1 tile border on all sides)
-	PhysicalWidth = Width + 2;
-	PhysicalHeight = Height + 2;
-	const int32 PhysicalNumCells = PhysicalWidth * PhysicalHeight;
+	// Reset utility states.
+	bHintRequestPending = false;
+	bWildLinkPrimed = false;
+	ClearHintState();
+	bHasLastFailedPair = false;
+	LastFailedTileA = FIntPoint(-1, -1);
+	LastFailedTileB = FIntPoint(-1, -1);
 
-	// Allocate physical board (includes padding)
-	Tiles.SetNum(PhysicalNumCells);
+	// Notify listeners (UI) to build/refresh.
+	NotifyBoardChanged();
+	NotifyCellsChanged(EOnetCellChangeKind::Reset, TArray<FIntPoint>());
+	NotifySelectionChanged(false, FirstSelection);
 
-	// Initialize all tiles to empty first (including padding)
-	for (int32 i = 0; i < PhysicalNumCells; ++i)
-	{
-		Tiles[i].TileTypeId = INDEX_NONE;
-		Tiles[i].bEmpty = true;
-	}
+	UE_LOG(LogTemp, Log, TEXT("Board initialized: %dx%d (physical: %dx%d) with %d unique tile types."),
+	       Core.GetWidth(), Core.GetHeight(), Core.GetWidth() + 2, Core.GetHeight() + 2, NumUniqueTypes);
 
-	// Each pair occupies 2 cells.
-	const int32 NumPairs = NumCells / 2;
+	// Ensure the starting layout has available moves (auto shuffle if needed).
+	CheckForDeadlockAndShuffleIfNeeded();
+	StartSpeculativeHint();
+}
 
-	// Clamp unique types so that each type has at least one pair.
-	const int32 NumUniqueTypes = FMath::Clamp(InNumTileTypes, 1, NumPairs);
+bool UOnetBoardComponent::GetTile(const int32 X, const int32 Y, FOnetTile& OutTile) const
+{
+	return Core.GetTile(X, Y, OutTile);
+}
 
-	// Build a bag of tile types: each type appears exactly twice.
-	// Then shuffle it to randomize placement.
-	TArray<int32> TypeBag;
-	TypeBag.Reserve(NumCells);
+void UOnetBoardComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelSolve();
+	CancelSpeculativeHint();
+	Super::EndPlay(EndPlayReason);
+}
 
-	for (int32 i = 0; i < NumPairs; i++)
+/**
+ * Snapshot the position and solve it on the thread pool.
+ * Board changes do not stop the solve, but a result that lands on a changed board is dropped and
+ * reported as Stale, so OnSolveFinished never carries moves for a board that is gone.
+ * A newer request supersedes it, which reports Cancelled.
+ *
+ * @param TimeBudgetSeconds - Wall-clock limit of the search (<= 0 means unlimited).
+ * @return False if there is no board to solve.
+ */
+bool UOnetBoardComponent::RequestSolve(const float TimeBudgetSeconds)
+{
+	if (!Core.IsInitialized())
 	{
-		const int32 TypeId = i % NumUniqueTypes;
-		// Add twice for the pair
-		TypeBag.Add(TypeId);
-		TypeBag.Add(TypeId);
+		return false;
 	}
 
-	// Fisher-Yates shuffle
-	for (int32 i = TypeBag.Num() - 1; i > 0; i--)
+	CancelSolve();
+
+	const TSharedRef<FOnetSolveControl, ESPMode::ThreadSafe> Control =
+		MakeShared<FOnetSolveControl, ESPMode::ThreadSafe>();
+	ActiveSolve = Control;
+	ActiveSolveVersion = Core.GetBoardVersion();
+
+	// Progress and results are only delivered while this request is still the active one.
+	TWeakObjectPtr<UOnetBoardComponent> WeakThis(this);
+
+	auto ReportProgress = [WeakThis, Control](const int64 Nodes, const double NodesPerSecond)
 	{
-		const int32 SwapIndex = FMath::RandRange(0, i);
-		if (i != SwapIndex) // Avoid unnecessary swap
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Control, Nodes, NodesPerSecond]()
 		{
-			TypeBag.Swap(i, SwapIndex);
-		}
-	}
+			UOnetBoardComponent* Board = WeakThis.Get();
+			if (Board && Board->ActiveSolve == Control)
+			{
+				Board->BroadcastSolveProgress(Nodes, static_cast<float>(NodesPerSecond));
+			}
+		});
+	};
 
-	// Populate only the inner logical region (skip padding)
-	int32 BagIndex = 0;
-	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+	auto Finish = [WeakThis, Control](const FOnetSolveResult& Result, const uint64 SolvedVersion)
 	{
-		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		UOnetBoardComponent* Board = WeakThis.Get();
+		if (!Board || Board->ActiveSolve != Control)
 		{
-			const int32 PhysIndex = LogicalToPhysicalIndex(LogicX, LogicY);
-			Tiles[PhysIndex].TileTypeId = TypeBag[BagIndex];
-			Tiles[PhysIndex].bEmpty = false;
-			BagIndex++;
+			return; // Cancelled or superseded; CancelSolve already reported it.
 		}
-	}
 
-	// Reset selection state
-	bHasFirstSelection = false;
-	FirstSelection = FIntPoint(-1, -1);
+		Board->ActiveSolve.Reset();
+		Board->LastSolveVersion = SolvedVersion;
+		if (SolvedVersion == Board->Core.GetBoardVersion())
+		{
+			Board->BroadcastSolveFinished(Result);
+			return;
+		}
 
-	// Reset utility states.
-	RemainingShuffleUses = MaxShuffleUses;
-	bWildLinkPrimed = false;
-	ClearHintState();
-	bHasLastFailedPair = false;
-	LastFailedTileA = FIntPoint(-1, -1);
-	LastFailedTileB = FIntPoint(-1, -1);
+		// The moves describe a board that no longer exists; keep only the search statistics.
+		FOnetSolveResult StaleResult;
+		StaleResult.Outcome = EOnetSolveOutcome::Stale;
+		StaleResult.NodesExpanded = Result.NodesExpanded;
+		StaleResult.NodesPerSecond = Result.NodesPerSecond;
+		Board->BroadcastSolveFinished(StaleResult);
+	};
 
-	// Notify listeners (UI) to build/refresh.
-	OnBoardChanged.Broadcast();
-	OnSelectionChanged.Broadcast(false, FirstSelection);
+	StartBackgroundSolve(Control, TimeBudgetSeconds, Finish, ReportProgress);
 
-	UE_LOG(LogTemp, Log, TEXT("Board initialized: %dx%d (physical: %dx%d) with %d unique tile types."),
-	       Width, Height, PhysicalWidth, PhysicalHeight, NumUniqueTypes);
+	return true;
+}
 
-	// Ensure the starting layout has available moves (auto shuffle if needed).
-	CheckForDeadlockAndShuffleIfNeeded();
+/**
+ * Run FOnetBoardSolver on a snapshot of the current board in the thread pool.
+ *
+ * @param Control - Cancellation flag shared with the caller.
+ * @param TimeBudgetSeconds - Wall-clock limit of the search.
+ * @param OnFinished - Receives the result and the snapshot's board version on the game thread.
+ * @param OnProgress - Optional progress report, called on the solving thread.
+ */
+void UOnetBoardComponent::StartBackgroundSolve(const TSharedRef<FOnetSolveControl, ESPMode::ThreadSafe>& Control,
+                                               const float TimeBudgetSeconds,
+                                               TFunction<void(const FOnetSolveResult&, uint64)> OnFinished,
+                                               TFunction<void(int64, double)> OnProgress)
+{
+	const FOnetBoardSnapshotRef Snapshot = GetSnapshot();
+	TWeakObjectPtr<UOnetBoardComponent> WeakThis(this);
+
+	Async(EAsyncExecution::ThreadPool,
+	      [WeakThis, Control, Snapshot, TimeBudgetSeconds, OnFinished = MoveTemp(OnFinished),
+		      OnProgress = MoveTemp(OnProgress)]() mutable
+	      {
+		      FOnetBoardSolver Solver(*Snapshot);
+		      FOnetSolveResult Result = Solver.Solve(TimeBudgetSeconds, &Control.Get(), OnProgress);
+
+		      AsyncTask(ENamedThreads::GameThread,
+		                [WeakThis, Snapshot, OnFinished = MoveTemp(OnFinished), Result = MoveTemp(Result)]()
+		                {
+			                // Whether a result for an older board version is still useful is the caller's call.
+			                if (WeakThis.IsValid())
+			                {
+				                OnFinished(Result, Snapshot->Version);
+			                }
+		                });
+	      });
 }
 
 /**
- * Read a tile at (X, Y). Returns false if out of bounds.
- * 
- * @param X - X coordinate of the tile.
- * @param Y - Y coordinate of the tile.
- * @param OutTile - Output parameter to receive the tile data.
- * @return - True if the tile is valid and returned, false if out of bounds.
+ * Stop the running solve and report it as Cancelled right away; the worker's own result is dropped.
  */
-bool UOnetBoardComponent::GetTile(const int32 X, const int32 Y, FOnetTile& OutTile) const
+void UOnetBoardComponent::CancelSolve()
 {
-	// Check logical bounds
-	if (!IsInBonds(X, Y))
+	if (!ActiveSolve.IsValid())
 	{
-		return false; // Out of bounds
+		return;
 	}
 
-	// Convert to physical index and retrieve tile
-	const int32 PhysIndex = LogicalToPhysicalIndex(X, Y);
-	OutTile = Tiles[PhysIndex];
-	return true;
+	ActiveSolve->bCancelRequested = true;
+	ActiveSolve.Reset();
+
+	FOnetSolveResult Result;
+	Result.Outcome = EOnetSolveOutcome::Cancelled;
+	LastSolveVersion = ActiveSolveVersion;
+	BroadcastSolveFinished(Result);
 }
 
 bool UOnetBoardComponent::RequestShuffle()
 {
+	FNotificationBatchScope NotificationBatch(*this);
 	const bool bResult = ShuffleInternal(false);
 	if (bResult)
 	{
 		CheckForDeadlockAndShuffleIfNeeded();
+		StartSpeculativeHint();
 	}
 	return bResult;
 }
 
 bool UOnetBoardComponent::RequestHint()
 {
-	if (bIsProcessingMatch || IsBoardCleared())
+	if (bIsProcessingMatch || Core.IsCleared())
 	{
 		return false;
 	}
 
 	ClearHintState();
+	const bool bHasHint = DeliverHint();
 
-	FIntPoint TileA;
-	FIntPoint TileB;
-	TArray<FIntPoint> Path;
-	if (FindFirstAvailableMatch(TileA, TileB, Path))
+	// The background search for this position has not landed yet; its move replaces this one when it does.
+	bHintRequestPending = bHasHint && ActiveHintSearch.IsValid() && !bHasSpeculativeHint;
+	return bHasHint;
+}
+
+/**
+ * Broadcast a hint for the current position. The speculative solver move is preferred; the move
+ * index is kept current across removals, so the fallback is a lookup as well.
+ *
+ * @return False if no move exists.
+ */
+bool UOnetBoardComponent::DeliverHint()
+{
+	if (bHasSpeculativeHint && SpeculativeHintVersion == Core.GetBoardVersion())
 	{
 		bHasHintPair = true;
-		HintTileA = TileA;
-		HintTileB = TileB;
-		OnHintUpdated.Broadcast(true, HintTileA, HintTileB);
+		HintTileA = SpeculativeHint.First;
+		HintTileB = SpeculativeHint.Second;
+		NotifyHintUpdated(true, HintTileA, HintTileB);
 		return true;
 	}
 
-	OnHintUpdated.Broadcast(false, FIntPoint(-1, -1), FIntPoint(-1, -1));
+	if (Core.GetAvailableMoveCount() > 0)
+	{
+		bHasHintPair = true;
+		HintTileA = Core.GetAvailableMoves()[0].First;
+		HintTileB = Core.GetAvailableMoves()[0].Second;
+		NotifyHintUpdated(true, HintTileA, HintTileB);
+		return true;
+	}
+
+	NotifyHintUpdated(false, FIntPoint(-1, -1), FIntPoint(-1, -1));
 	return false;
 }
 
+/**
+ * Look for the next hint in the background, right after the board settled (initialization,
+ * a removal, a shuffle), so that RequestHint usually finds it ready. Large boards skip the
+ * search: a full solve there outlives any hint budget, and the move index answers anyway.
+ */
+void UOnetBoardComponent::StartSpeculativeHint()
+{
+	CancelSpeculativeHint();
+
+	if (!bUseSolverHints || Core.IsLargeBoard() || Core.IsCleared() || Core.GetAvailableMoveCount() == 0)
+	{
+		return;
+	}
+
+	const TSharedRef<FOnetSolveControl, ESPMode::ThreadSafe> Control =
+		MakeShared<FOnetSolveControl, ESPMode::ThreadSafe>();
+	ActiveHintSearch = Control;
+
+	TWeakObjectPtr<UOnetBoardComponent> WeakThis(this);
+
+	// A hint is only worth anything for the board it was searched on.
+	auto Finish = [WeakThis, Control](const FOnetSolveResult& Result, const uint64 SolvedVersion)
+	{
+		UOnetBoardComponent* Board = WeakThis.Get();
+		if (!Board || Board->ActiveHintSearch != Control || SolvedVersion != Board->Core.GetBoardVersion())
+		{
+			return;
+		}
+
+		Board->ActiveHintSearch.Reset();
+		if (Result.Outcome == EOnetSolveOutcome::Solved && Result.Moves.Num() > 0)
+		{
+			Board->bHasSpeculativeHint = true;
+			Board->SpeculativeHint = Result.Moves[0];
+			Board->SpeculativeHintVersion = SolvedVersion;
+		}
+
+		// Swap the move-index hint on display for the solver's move.
+		if (Board->bHintRequestPending && Board->bHasSpeculativeHint && Board->bHasHintPair &&
+			!Board->bIsProcessingMatch)
+		{
+			Board->DeliverHint();
+		}
+		Board->bHintRequestPending = false;
+	};
+
+	StartBackgroundSolve(Control, HintSearchBudgetSeconds, Finish);
+}
+
+void UOnetBoardComponent::CancelSpeculativeHint()
+{
+	if (ActiveHintSearch.IsValid())
+	{
+		ActiveHintSearch->bCancelRequested = true;
+		ActiveHintSearch.Reset();
+	}
+	bHasSpeculativeHint = false;
+	bHintRequestPending = false;
+}
+
 bool UOnetBoardComponent::ActivateWildLink()
 {
-	if (IsBoardCleared())
+	if (Core.IsCleared())
 	{
 		return false;
 	}
@@ -185,7 +339,7 @@ bool UOnetBoardComponent::ActivateWildLink()
 	}
 
 	bWildLinkPrimed = true;
-	OnWildStateChanged.Broadcast(true);
+	BroadcastWildStateChanged(true);
 	return true;
 }
 
@@ -205,168 +359,27 @@ void UOnetBoardComponent::ClearSelection()
 	{
 		bHasFirstSelection = false;
 		FirstSelection = FIntPoint(-1, -1);
-		OnSelectionChanged.Broadcast(false, FirstSelection);
+		ResetSelectionReach();
+		NotifySelectionChanged(false, FirstSelection);
 	}
 }
 
-/**
- * Check if two tiles can be linked with at most 2 turns using BFS.
- * The path can only go through empty tiles (or the start/end tiles).
- *
- * @param X1, Y1 - Coordinates of the first tile.
- * @param X2, Y2 - Coordinates of the second tile.
- * @param OutPath - Output parameter to receive the path points.
- * @return True if a valid path exists with at most 2 turns.
- */
+bool UOnetBoardComponent::GetSelectionPartners(TArray<FIntPoint>& OutPartners) const
+{
+	OutPartners = SelectionPartners;
+	return bHasFirstSelection && SelectionPartners.Num() > 0;
+}
+
 bool UOnetBoardComponent::CanLink(const int32 X1, const int32 Y1, const int32 X2, const int32 Y2,
                                   TArray<FIntPoint>& OutPath) const
 {
-	OutPath.Empty();
-
-	UE_LOG(LogTemp, Warning, TEXT("CanLink called: (%d,%d) -> (%d,%d)"), X1, Y1, X2, Y2);
-
-	// Same position is not a valid link.
-	if (X1 == X2 && Y1 == Y2)
-	{
-		return false;
-	}
-
-	// Check if both tiles are in logical bounds and not empty.
-	if (!IsInBonds(X1, Y1) || !IsInBonds(X2, Y2))
-	{
-		return false;
-	}
-
-	const int32 Index1 = LogicalToPhysicalIndex(X1, Y1);
-	const int32 Index2 = LogicalToPhysicalIndex(X2, Y2);
-
-	if (Tiles[Index1].bEmpty || Tiles[Index2].bEmpty)
-	{
-		return false;
-	}
-
-	// Check if tiles have the same type.
-	if (Tiles[Index1].TileTypeId != Tiles[Index2].TileTypeId)
-	{
-		return false;
-	}
-
-	// Convert logical coordinates to physical for pathfinding
-	const FIntPoint PhysStart = LogicalToPhysical(FIntPoint(X1, Y1));
-	const FIntPoint PhysEnd = LogicalToPhysical(FIntPoint(X2, Y2));
-
-	// BFS structure: Position, Direction, Turns, Path
-	struct FPathNode
-	{
-		FIntPoint Position; // Physical coordinates
-		int32 Direction; // 0=Right, 1=Down, 2=Left, 3=Up, -1=Start
-		int32 Turns;
-		TArray<FIntPoint> Path; // Physical coordinates
-
-		// Default constructor for TQueue::Dequeue
-		FPathNode()
-			: Position(FIntPoint::ZeroValue), Direction(-1), Turns(0)
-		{
-		}
-
-		FPathNode(const FIntPoint& InPos, const int32 InDir, const int32 InTurns, const TArray<FIntPoint>& InPath)
-			: Position(InPos), Direction(InDir), Turns(InTurns), Path(InPath)
-		{
-		}
-	};
-
-	// Direction vectors: Right, Down, Left, Up
-	const FIntPoint Directions[] = {
-		FIntPoint(1, 0), // Right
-		FIntPoint(0, 1), // Down
-		FIntPoint(-1, 0), // Left
-		FIntPoint(0, -1) // Up
-	};
-
-	TQueue<FPathNode> Queue;
-	TMap<TPair<FIntPoint, int32>, int32> VisitedMinTurns; // (Position, Direction) -> Min turns seen
-
-	// Start from the first tile with no initial direction (using physical coordinates).
-	// Direction -1 means "no direction yet", so the first move won't count as a turn.
-	TArray<FIntPoint> InitialPath;
-	InitialPath.Add(PhysStart);
-	Queue.Enqueue(FPathNode(PhysStart, -1, 0, InitialPath));
-
-	while (!Queue.IsEmpty())
-	{
-		FPathNode Current;
-		Queue.Dequeue(Current);
-
-		// Try moving in all four directions.
-		for (int32 NewDir = 0; NewDir < 4; ++NewDir)
-		{
-			const FIntPoint NextPos = Current.Position + Directions[NewDir];
-
-			// Calculate turns: if direction changes, increment turn count.
-			int32 NewTurns = Current.Turns;
-			if (Current.Direction != -1 && Current.Direction != NewDir)
-			{
-				NewTurns++;
-			}
-
-			// Exceeded maximum turns.
-			if (NewTurns > 2)
-			{
-				continue;
-			}
-
-			// Check if next position is in physical bounds.
-			if (!IsPhysicalInBounds(NextPos.X, NextPos.Y))
-			{
-				continue;
-			}
-
-			const int32 NextIndex = PhysicalToIndex(NextPos.X, NextPos.Y);
-
-			// Check if we reached the target.
-			if (NextPos == PhysEnd)
-			{
-				// Found a valid path! Convert back to logical coordinates for UI.
-				TArray<FIntPoint> FinalPath;
-				FinalPath.Reserve(Current.Path.Num() + 1);
-				for (const FIntPoint& PhysPos : Current.Path)
-				{
-					FinalPath.Add(FIntPoint(PhysPos.X - 1, PhysPos.Y - 1)); // Convert to logical
-				}
-				FinalPath.Add(FIntPoint(NextPos.X - 1, NextPos.Y - 1)); // Convert to logical
-				OutPath = FinalPath;
-				return true;
-			}
-
-			// Can only move through empty tiles (not the start or end).
-			if (!Tiles[NextIndex].bEmpty)
-			{
-				continue;
-			}
-
-			// Check if we've already visited this state with fewer or equal turns.
-			const TPair<FIntPoint, int32> State(NextPos, NewDir);
-			if (int32* ExistingTurns = VisitedMinTurns.Find(State))
-			{
-				if (NewTurns >= *ExistingTurns)
-				{
-					continue;
-				}
-			}
-
-			VisitedMinTurns.Add(State, NewTurns);
-
-			// Add to queue.
-			TArray<FIntPoint> NewPath = Current.Path;
-			NewPath.Add(NextPos);
-			Queue.Enqueue(FPathNode(NextPos, NewDir, NewTurns, NewPath));
-		}
-	}
-
-	UE_LOG(LogTemp, Warning, TEXT("CanLink: No path found after BFS"));
+	return Core.CanLink(X1, Y1, X2, Y2, OutPath);
+}
 
-	// No valid path found.
-	return false;
+int32 UOnetBoardComponent::CanLinkBatch(const TConstArrayView<FOnetTilePair> Pairs, TBitArray<>& OutLinked,
+                                        TArray<TArray<FIntPoint>>* OutPaths) const
+{
+	return Core.CanLinkBatch(Pairs, OutLinked, OutPaths);
 }
 
 void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
@@ -379,7 +392,7 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 		return;
 	}
 
-	if (!IsInBonds(X, Y) || Tiles.Num() == 0)
+	if (!Core.IsInBounds(X, Y))
 	{
 		return;
 	}
@@ -389,10 +402,8 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 	LastFailedTileA = FIntPoint(-1, -1);
 	LastFailedTileB = FIntPoint(-1, -1);
 
-	const int32 Index = LogicalToPhysicalIndex(X, Y); // Convert logical (X, Y) to physical index.
-
 	// Checking an empty tile does nothing.
-	if (Tiles[Index].bEmpty)
+	if (Core.GetTileType(X, Y) == INDEX_NONE)
 	{
 		return;
 	}
@@ -407,7 +418,10 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 		FirstSelection = Clicked;
 
 		// UI can highlight the first selection.
-		OnSelectionChanged.Broadcast(true, FirstSelection);
+		NotifySelectionChanged(true, FirstSelection);
+
+		// Resolve everything this tile can reach now, so the second click is a lookup.
+		UpdateSelectionReach();
 		return;
 	}
 
@@ -416,9 +430,10 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 	{
 		bHasFirstSelection = false;
 		FirstSelection = FIntPoint(-1, -1);
+		ResetSelectionReach();
 
 		// UI clears selection highlight.
-		OnSelectionChanged.Broadcast(false, FirstSelection);
+		NotifySelectionChanged(false, FirstSelection);
 		return;
 	}
 
@@ -427,9 +442,8 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 	bool bCanLink = false;
 	bool bConsumedWild = false;
 
-	const int32 FirstIndex = LogicalToPhysicalIndex(FirstSelection.X, FirstSelection.Y);
-	const int32 SecondIndex = Index;
-	const bool bTilesMatch = Tiles[FirstIndex].TileTypeId == Tiles[SecondIndex].TileTypeId;
+	const bool bTilesMatch =
+		Core.GetTileType(FirstSelection.X, FirstSelection.Y) == Core.GetTileType(X, Y);
 
 	if (bWildLinkPrimed && bTilesMatch)
 	{
@@ -439,9 +453,17 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 		bCanLink = true;
 		bConsumedWild = true;
 	}
+	else if (bSelectionReachValid)
+	{
+		// The reach set was flooded on the first click; only the chosen pair's path is rebuilt.
+		if (bTilesMatch && SelectionReach[Core.GetCellIndex(Clicked)])
+		{
+			bCanLink = Core.FindLinkPath(FirstSelection, Clicked, Path);
+		}
+	}
 	else
 	{
-		bCanLink = CanLink(FirstSelection.X, FirstSelection.Y, X, Y, Path);
+		bCanLink = Core.CanLink(FirstSelection.X, FirstSelection.Y, X, Y, Path);
 	}
 
 	if (bCanLink)
@@ -457,7 +479,7 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 
 		// Broadcast match successful event with the path for animation.
 		// UI will draw the connection line.
-		OnMatchSuccessful.Broadcast(Path);
+		BroadcastMatchSuccessful(Path);
 
 		// Set timer to remove tiles after delay (allows animation to play).
 		if (UWorld* World = GetWorld())
@@ -474,7 +496,7 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 		if (bConsumedWild)
 		{
 			bWildLinkPrimed = false;
-			OnWildStateChanged.Broadcast(false);
+			BroadcastWildStateChanged(false);
 		}
 	}
 	else
@@ -486,13 +508,14 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
 		LastFailedTileB = Clicked;
 
 		// Broadcast match failed event for feedback.
-		OnMatchFailed.Broadcast();
+		BroadcastMatchFailed();
 	}
 
 	// Reset selection after the second click for simple UX.
 	bHasFirstSelection = false;
 	FirstSelection = FIntPoint(-1, -1);
-	OnSelectionChanged.Broadcast(false, FirstSelection);
+	ResetSelectionReach();
+	NotifySelectionChanged(false, FirstSelection);
 }
 
 /**
@@ -501,12 +524,14 @@ void UOnetBoardComponent::HandleTileClicked(const int32 X, const int32 Y)
  */
 void UOnetBoardComponent::RemoveMatchedTiles()
 {
+	FNotificationBatchScope NotificationBatch(*this);
+
 	// Remove the matched tiles.
-	const int32 Index1 = LogicalToPhysicalIndex(PendingRemovalTile1.X, PendingRemovalTile1.Y);
-	const int32 Index2 = LogicalToPhysicalIndex(PendingRemovalTile2.X, PendingRemovalTile2.Y);
+	SyncCoreRules();
+	Core.RemovePair(PendingRemovalTile1, PendingRemovalTile2);
+	MarkBoardChanged();
 
-	Tiles[Index1].bEmpty = true;
-	Tiles[Index2].bEmpty = true;
+	const TArray<FIntPoint> RemovedCells = {PendingRemovalTile1, PendingRemovalTile2};
 
 	// Clear pending removal data.
 	PendingRemovalTile1 = FIntPoint(-1, -1);
@@ -518,29 +543,96 @@ void UOnetBoardComponent::RemoveMatchedTiles()
 	// Clear any pending hint since board state changed.
 	ClearHintState();
 
-	// Notify UI to refresh and hide the tiles.
-	OnBoardChanged.Broadcast();
+	// Notify UI to hide the two tiles.
+	NotifyCellsChanged(EOnetCellChangeKind::Removed, RemovedCells);
 
 	UE_LOG(LogTemp, Log, TEXT("Matched tiles removed."));
 
-	if (IsBoardCleared())
+	if (Core.IsCleared())
 	{
-		OnBoardCleared.Broadcast();
+		NotifyBoardCleared();
 	}
 	else
 	{
 		CheckForDeadlockAndShuffleIfNeeded();
 	}
+
+	// Have the next hint ready before the player asks for it.
+	StartSpeculativeHint();
+}
+
+/**
+ * Flood the reach set of the current first selection and notify listeners of its valid partners.
+ */
+void UOnetBoardComponent::UpdateSelectionReach()
+{
+	SelectionPartners.Reset();
+	bSelectionReachValid = false;
+
+	if (!bHasFirstSelection || !Core.IsInBounds(FirstSelection.X, FirstSelection.Y))
+	{
+		return;
+	}
+
+	Core.ComputeReachableCells(FirstSelection, SelectionReach);
+	bSelectionReachValid = true;
+
+	const int32 SelectedType = Core.GetTileType(FirstSelection.X, FirstSelection.Y);
+	for (TConstSetBitIterator<> It(SelectionReach); It; ++It)
+	{
+		// Reach bits are only set on occupied cells, and the selected cell is occupied.
+		if (Core.GetTileTypeByIndex(It.GetIndex()) == SelectedType)
+		{
+			SelectionPartners.Add(Core.GetCellCoordinates(It.GetIndex()));
+		}
+	}
+
+	NotifySelectionPartnersChanged();
+}
+
+/**
+ * Drop the cached reach set and tell listeners the partner list is gone.
+ */
+void UOnetBoardComponent::ResetSelectionReach()
+{
+	bSelectionReachValid = false;
+	if (SelectionPartners.Num() > 0)
+	{
+		SelectionPartners.Reset();
+		NotifySelectionPartnersChanged();
+	}
+}
+
+/**
+ * Drop everything derived from the previous board version. Called after every change made through Core.
+ * A requested solve keeps running: its result names the version it describes.
+ */
+void UOnetBoardComponent::MarkBoardChanged()
+{
+	bSelectionReachValid = false;
+	CancelSpeculativeHint();
+}
+
+void UOnetBoardComponent::SyncCoreRules()
+{
+	Core.Rules.BoardGeneration = BoardGeneration;
+	Core.Rules.ShuffleMode = ShuffleMode;
+	Core.Rules.ShuffleGuaranteedMoves = ShuffleGuaranteedMoves;
+	Core.Rules.ShuffleCandidateCount = ShuffleCandidateCount;
+	Core.Rules.ParallelSearchMinCells = ParallelSearchMinCells;
+	Core.Rules.MaxShuffleUses = MaxShuffleUses;
+	Core.Rules.LargeBoardMinCells = LargeBoardMinCells;
+	Core.Rules.RandomSeed = RandomSeed;
 }
 
 bool UOnetBoardComponent::ShuffleInternal(const bool bAutoTriggered)
 {
-	if (Width <= 0 || Height <= 0 || Tiles.Num() == 0)
+	if (!Core.IsInitialized())
 	{
 		return false;
 	}
 
-	if (RemainingShuffleUses <= 0)
+	if (Core.GetRemainingShuffleUses() <= 0)
 	{
 		return false;
 	}
@@ -553,71 +645,23 @@ bool UOnetBoardComponent::ShuffleInternal(const bool bAutoTriggered)
 	bIsProcessingMatch = false;
 	bHasFirstSelection = false;
 	FirstSelection = FIntPoint(-1, -1);
+	ResetSelectionReach();
 	PendingRemovalTile1 = FIntPoint(-1, -1);
 	PendingRemovalTile2 = FIntPoint(-1, -1);
 
 	ClearHintState();
 
-	// Collect remaining tile types and logical slots.
-	TArray<int32> RemainingTypes;
-	TArray<FIntPoint> LogicalSlots;
-	RemainingTypes.Reserve(Width * Height);
-	LogicalSlots.Reserve(Width * Height);
-
-	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
-	{
-		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
-		{
-			const int32 PhysIndex = LogicalToPhysicalIndex(LogicX, LogicY);
-			if (!Tiles[PhysIndex].bEmpty)
-			{
-				RemainingTypes.Add(Tiles[PhysIndex].TileTypeId);
-			}
-
-			// Reset tile to empty before reassigning.
-			Tiles[PhysIndex].TileTypeId = INDEX_NONE;
-			Tiles[PhysIndex].bEmpty = true;
-			LogicalSlots.Add(FIntPoint(LogicX, LogicY));
-		}
-	}
-
-	// Shuffle types and slot order.
-	for (int32 i = RemainingTypes.Num() - 1; i > 0; --i)
-	{
-		const int32 SwapIndex = FMath::RandRange(0, i);
-		if (i != SwapIndex)
-		{
-			RemainingTypes.Swap(i, SwapIndex);
-		}
-	}
-
-	for (int32 i = LogicalSlots.Num() - 1; i > 0; --i)
-	{
-		const int32 SwapIndex = FMath::RandRange(0, i);
-		if (i != SwapIndex)
-		{
-			LogicalSlots.Swap(i, SwapIndex);
-		}
-	}
-
-	// Refill board.
-	const int32 NumToPlace = FMath::Min(RemainingTypes.Num(), LogicalSlots.Num());
-	for (int32 i = 0; i < NumToPlace; ++i)
-	{
-		const FIntPoint& Slot = LogicalSlots[i];
-		const int32 PhysIndex = LogicalToPhysicalIndex(Slot.X, Slot.Y);
-		Tiles[PhysIndex].TileTypeId = RemainingTypes[i];
-		Tiles[PhysIndex].bEmpty = false;
-	}
-
-	RemainingShuffleUses = FMath::Max(0, RemainingShuffleUses - 1);
+	SyncCoreRules();
+	TArray<FIntPoint> ChangedCells;
+	Core.Shuffle(&ChangedCells);
+	MarkBoardChanged();
 
 	// Notify UI.
-	OnBoardChanged.Broadcast();
-	OnSelectionChanged.Broadcast(false, FIntPoint(-1, -1));
-	OnShufflePerformed.Broadcast(RemainingShuffleUses, bAutoTriggered);
+	NotifyCellsChanged(EOnetCellChangeKind::Retyped, ChangedCells);
+	NotifySelectionChanged(false, FIntPoint(-1, -1));
+	NotifyShufflePerformed(bAutoTriggered);
 
-	UE_LOG(LogTemp, Log, TEXT("Shuffle performed. Remaining: %d (auto: %s)"), RemainingShuffleUses,
+	UE_LOG(LogTemp, Log, TEXT("Shuffle performed. Remaining: %d (auto: %s)"), Core.GetRemainingShuffleUses(),
 	       bAutoTriggered ? TEXT("true") : TEXT("false"));
 
 	return true;
@@ -625,7 +669,7 @@ bool UOnetBoardComponent::ShuffleInternal(const bool bAutoTriggered)
 
 void UOnetBoardComponent::CheckForDeadlockAndShuffleIfNeeded()
 {
-	if (bResolvingDeadlock || IsBoardCleared())
+	if (bResolvingDeadlock || Core.IsCleared())
 	{
 		return;
 	}
@@ -649,108 +693,406 @@ void UOnetBoardComponent::CheckForDeadlockAndShuffleIfNeeded()
 		}
 	} ResolveGuard(bResolvingDeadlock);
 
-	while (!IsBoardCleared())
+	// Several auto shuffles in a row still reach listeners as one shuffle and one cell delta.
+	FNotificationBatchScope NotificationBatch(*this);
+
+	while (!Core.IsCleared())
 	{
-		FIntPoint TileA;
-		FIntPoint TileB;
-		TArray<FIntPoint> Path;
-		if (FindFirstAvailableMatch(TileA, TileB, Path))
+		if (Core.GetAvailableMoveCount() > 0)
 		{
 			break; // At least one move exists.
 		}
 
 		if (!ShuffleInternal(true))
 		{
-			OnNoMovesRemain.Broadcast();
+			NotifyNoMovesRemain();
 			break;
 		}
 	}
 }
 
-bool UOnetBoardComponent::FindFirstAvailableMatch(FIntPoint& OutTileA, FIntPoint& OutTileB,
-                                                  TArray<FIntPoint>& OutPath) const
+void UOnetBoardComponent::ClearHintState()
+{
+	if (bHasHintPair)
+	{
+		bHasHintPair = false;
+		HintTileA = FIntPoint(-1, -1);
+		HintTileB = FIntPoint(-1, -1);
+		NotifyHintUpdated(false, HintTileA, HintTileB);
+	}
+}
+
+void UOnetBoardComponent::GetAvailableMoves(TArray<FOnetTilePair>& OutMoves) const
 {
-	OutTileA = FIntPoint(-1, -1);
-	OutTileB = FIntPoint(-1, -1);
-	OutPath.Empty();
+	OutMoves = Core.GetAvailableMoves();
+}
 
-	if (Width <= 0 || Height <= 0 || IsBoardCleared())
+bool UOnetBoardComponent::GetLastFailedPair(FIntPoint& OutFirst, FIntPoint& OutSecond) const
+{
+	OutFirst = LastFailedTileA;
+	OutSecond = LastFailedTileB;
+	return bHasLastFailedPair;
+}
+
+void UOnetBoardComponent::BeginNotificationBatch()
+{
+	++NotificationBatchDepth;
+}
+
+/**
+ * Close one explicit batch. Unbalanced calls are ignored; the per-frame batch is closed by its
+ * own timer only, so an extra End never flushes it early.
+ */
+void UOnetBoardComponent::EndNotificationBatch()
+{
+	if (NotificationBatchDepth <= 0)
 	{
-		return false;
+		return;
+	}
+
+	if (--NotificationBatchDepth == 0 && !bFrameBatchOpen)
+	{
+		FlushNotifications();
+	}
+}
+
+void UOnetBoardComponent::EndFrameNotificationBatch()
+{
+	bFrameBatchOpen = false;
+	if (NotificationBatchDepth == 0)
+	{
+		FlushNotifications();
 	}
+}
 
-	// Group tiles by type to minimize checks.
-	TMap<int32, TArray<FIntPoint>> TilesByType;
-	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+/**
+ * Whether the notification being raised should be recorded instead of broadcast.
+ * With bBatchNotificationsPerFrame, the first notification of a frame opens a batch that the
+ * timer manager closes on the next tick.
+ */
+bool UOnetBoardComponent::ShouldDeferNotification()
+{
+	if (bBatchNotificationsPerFrame && !bFrameBatchOpen)
 	{
-		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		if (UWorld* World = GetWorld())
 		{
-			const int32 PhysIndex = LogicalToPhysicalIndex(LogicX, LogicY);
-			if (!Tiles[PhysIndex].bEmpty)
-			{
-				TilesByType.FindOrAdd(Tiles[PhysIndex].TileTypeId).Add(FIntPoint(LogicX, LogicY));
-			}
+			bFrameBatchOpen = true;
+			World->GetTimerManager().SetTimerForNextTick(this, &UOnetBoardComponent::EndFrameNotificationBatch);
 		}
 	}
 
-	for (const TPair<int32, TArray<FIntPoint>>& Entry : TilesByType)
+	return NotificationBatchDepth > 0 || bFrameBatchOpen;
+}
+
+void UOnetBoardComponent::NotifyBoardChanged()
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastBoardChanged();
+		return;
+	}
+
+	// A new board supersedes every cell delta recorded so far.
+	PendingNotifications.bBoardChanged = true;
+	PendingNotifications.bCellsChanged = false;
+	PendingNotifications.bOnlyRemovals = true;
+	PendingNotifications.ChangedCells.Empty();
+}
+
+void UOnetBoardComponent::NotifyCellsChanged(const EOnetCellChangeKind Kind, const TArray<FIntPoint>& Cells)
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastCellsChanged(Kind, Cells);
+		return;
+	}
+
+	// Resets are implied by bBoardChanged, and every delta after a new board is covered by it.
+	if (Kind == EOnetCellChangeKind::Reset || PendingNotifications.bBoardChanged)
 	{
-		const TArray<FIntPoint>& Positions = Entry.Value;
-		for (int32 i = 0; i < Positions.Num(); ++i)
+		return;
+	}
+
+	const int32 W = Core.GetWidth();
+	PendingNotifications.ChangedCells.SetNum(W * Core.GetHeight(), false);
+	for (const FIntPoint& Cell : Cells)
+	{
+		if (Core.IsInBounds(Cell.X, Cell.Y))
 		{
-			for (int32 j = i + 1; j < Positions.Num(); ++j)
-			{
-				TArray<FIntPoint> CandidatePath;
-				if (CanLink(Positions[i].X, Positions[i].Y, Positions[j].X, Positions[j].Y, CandidatePath))
-				{
-					OutTileA = Positions[i];
-					OutTileB = Positions[j];
-					OutPath = CandidatePath;
-					return true;
-				}
-			}
+			PendingNotifications.ChangedCells[Cell.Y * W + Cell.X] = true;
 		}
 	}
 
-	return false;
+	PendingNotifications.bCellsChanged = true;
+	PendingNotifications.bOnlyRemovals &= Kind == EOnetCellChangeKind::Removed;
 }
 
-void UOnetBoardComponent::ClearHintState()
+void UOnetBoardComponent::NotifySelectionChanged(const bool bHasSelection, const FIntPoint& Selection)
 {
-	if (bHasHintPair)
+	if (!ShouldDeferNotification())
 	{
-		bHasHintPair = false;
-		HintTileA = FIntPoint(-1, -1);
-		HintTileB = FIntPoint(-1, -1);
-		OnHintUpdated.Broadcast(false, HintTileA, HintTileB);
+		BroadcastSelectionChanged(bHasSelection, Selection);
+		return;
 	}
+
+	PendingNotifications.bSelectionChanged = true;
+	PendingNotifications.bHasFirstSelection = bHasSelection;
+	PendingNotifications.FirstSelection = Selection;
 }
 
-bool UOnetBoardComponent::IsBoardCleared() const
+void UOnetBoardComponent::NotifySelectionPartnersChanged()
 {
-	if (Width <= 0 || Height <= 0)
+	if (!ShouldDeferNotification())
 	{
-		return true;
+		BroadcastSelectionPartnersChanged();
+		return;
+	}
+
+	// The partner list is read when the batch is flushed.
+	PendingNotifications.bSelectionPartnersChanged = true;
+}
+
+void UOnetBoardComponent::NotifyShufflePerformed(const bool bAutoTriggered)
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastShufflePerformed(bAutoTriggered);
+		return;
+	}
+
+	// The remaining charges are read when the batch is flushed.
+	PendingNotifications.bShufflePerformed = true;
+	PendingNotifications.bShuffleAutoTriggered |= bAutoTriggered;
+}
+
+void UOnetBoardComponent::NotifyHintUpdated(const bool bHasHint, const FIntPoint& First, const FIntPoint& Second)
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastHintUpdated(bHasHint, First, Second);
+		return;
+	}
+
+	PendingNotifications.bHintUpdated = true;
+	PendingNotifications.bHasHint = bHasHint;
+	PendingNotifications.HintFirst = First;
+	PendingNotifications.HintSecond = Second;
+}
+
+void UOnetBoardComponent::NotifyBoardCleared()
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastBoardCleared();
+		return;
+	}
+
+	PendingNotifications.bBoardCleared = true;
+}
+
+void UOnetBoardComponent::NotifyNoMovesRemain()
+{
+	if (!ShouldDeferNotification())
+	{
+		BroadcastNoMovesRemain();
+		return;
 	}
 
-	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+	PendingNotifications.bNoMovesRemain = true;
+}
+
+/**
+ * Broadcast the merged batch in the order the events are raised without batching: board, cells,
+ * selection, selection partners, shuffle, hint, then the end-of-game events.
+ */
+void UOnetBoardComponent::FlushNotifications()
+{
+	// Listeners may open a new batch; they start from a clean record.
+	FPendingNotifications Pending = MoveTemp(PendingNotifications);
+	PendingNotifications = FPendingNotifications();
+
+	if (Pending.bBoardChanged)
+	{
+		BroadcastBoardChanged();
+		BroadcastCellsChanged(EOnetCellChangeKind::Reset, TArray<FIntPoint>());
+	}
+	else if (Pending.bCellsChanged)
 	{
-		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		const int32 W = FMath::Max(1, Core.GetWidth());
+		TArray<FIntPoint> Cells;
+		for (TConstSetBitIterator<> It(Pending.ChangedCells); It; ++It)
 		{
-			const int32 PhysIndex = LogicalToPhysicalIndex(LogicX, LogicY);
-			if (!Tiles[PhysIndex].bEmpty)
-			{
-				return false;
-			}
+			Cells.Add(FIntPoint(It.GetIndex() % W, It.GetIndex() / W));
 		}
+
+		BroadcastCellsChanged(
+			Pending.bOnlyRemovals ? EOnetCellChangeKind::Removed : EOnetCellChangeKind::Retyped, Cells);
 	}
 
-	return true;
+	if (Pending.bSelectionChanged)
+	{
+		BroadcastSelectionChanged(Pending.bHasFirstSelection, Pending.FirstSelection);
+	}
+
+	if (Pending.bSelectionPartnersChanged)
+	{
+		BroadcastSelectionPartnersChanged();
+	}
+
+	if (Pending.bShufflePerformed)
+	{
+		BroadcastShufflePerformed(Pending.bShuffleAutoTriggered);
+	}
+
+	if (Pending.bHintUpdated)
+	{
+		BroadcastHintUpdated(Pending.bHasHint, Pending.HintFirst, Pending.HintSecond);
+	}
+
+	if (Pending.bBoardCleared)
+	{
+		BroadcastBoardCleared();
+	}
+
+	if (Pending.bNoMovesRemain)
+	{
+		BroadcastNoMovesRemain();
+	}
 }
 
-bool UOnetBoardComponent::GetLastFailedPair(FIntPoint& OutFirst, FIntPoint& OutSecond) const
+void UOnetBoardComponent::AddObserver(IOnetBoardObserver* Observer)
 {
-	OutFirst = LastFailedTileA;
-	OutSecond = LastFailedTileB;
-	return bHasLastFailedPair;
+	if (Observer)
+	{
+		Observers.AddUnique(Observer);
+	}
+}
+
+void UOnetBoardComponent::RemoveObserver(IOnetBoardObserver* Observer)
+{
+	if (!Observer)
+	{
+		return;
+	}
+
+	// A dispatch in progress walks Observers by index; keep the indices stable until it ends.
+	if (ObserverDispatchDepth > 0)
+	{
+		const int32 Index = Observers.Find(Observer);
+		if (Index != INDEX_NONE)
+		{
+			Observers[Index] = nullptr;
+		}
+		return;
+	}
+
+	Observers.Remove(Observer);
+}
+
+void UOnetBoardComponent::BroadcastBoardChanged()
+{
+	OnBoardChangedNative.Broadcast();
+	ForEachObserver([](IOnetBoardObserver& Observer) { Observer.OnBoardChanged(); });
+	OnBoardChanged.Broadcast();
+}
+
+void UOnetBoardComponent::BroadcastCellsChanged(const EOnetCellChangeKind Kind, const TArray<FIntPoint>& Cells)
+{
+	OnCellsChangedNative.Broadcast(Kind, Cells);
+	ForEachObserver([Kind, &Cells](IOnetBoardObserver& Observer) { Observer.OnCellsChanged(Kind, Cells); });
+	OnCellsChanged.Broadcast(Kind, Cells);
+}
+
+void UOnetBoardComponent::BroadcastSelectionChanged(const bool bHasSelection, const FIntPoint& Selection)
+{
+	OnSelectionChangedNative.Broadcast(bHasSelection, Selection);
+	ForEachObserver([bHasSelection, &Selection](IOnetBoardObserver& Observer)
+	{
+		Observer.OnSelectionChanged(bHasSelection, Selection);
+	});
+	OnSelectionChanged.Broadcast(bHasSelection, Selection);
+}
+
+void UOnetBoardComponent::BroadcastSelectionPartnersChanged()
+{
+	OnSelectionPartnersChangedNative.Broadcast(SelectionPartners);
+	ForEachObserver([this](IOnetBoardObserver& Observer) { Observer.OnSelectionPartnersChanged(SelectionPartners); });
+	OnSelectionPartnersChanged.Broadcast(SelectionPartners);
+}
+
+void UOnetBoardComponent::BroadcastMatchSuccessful(const TArray<FIntPoint>& Path)
+{
+	OnMatchSuccessfulNative.Broadcast(Path);
+	ForEachObserver([&Path](IOnetBoardObserver& Observer) { Observer.OnMatchSuccessful(Path); });
+	OnMatchSuccessful.Broadcast(Path);
+}
+
+void UOnetBoardComponent::BroadcastMatchFailed()
+{
+	OnMatchFailedNative.Broadcast();
+	ForEachObserver([](IOnetBoardObserver& Observer) { Observer.OnMatchFailed(); });
+	OnMatchFailed.Broadcast();
+}
+
+void UOnetBoardComponent::BroadcastShufflePerformed(const bool bAutoTriggered)
+{
+	const int32 RemainingUses = Core.GetRemainingShuffleUses();
+	OnShufflePerformedNative.Broadcast(RemainingUses, bAutoTriggered);
+	ForEachObserver([RemainingUses, bAutoTriggered](IOnetBoardObserver& Observer)
+	{
+		Observer.OnShufflePerformed(RemainingUses, bAutoTriggered);
+	});
+	OnShufflePerformed.Broadcast(RemainingUses, bAutoTriggered);
+}
+
+void UOnetBoardComponent::BroadcastHintUpdated(const bool bHasHint, const FIntPoint& First, const FIntPoint& Second)
+{
+	OnHintUpdatedNative.Broadcast(bHasHint, First, Second);
+	ForEachObserver([bHasHint, &First, &Second](IOnetBoardObserver& Observer)
+	{
+		Observer.OnHintUpdated(bHasHint, First, Second);
+	});
+	OnHintUpdated.Broadcast(bHasHint, First, Second);
+}
+
+void UOnetBoardComponent::BroadcastWildStateChanged(const bool bWildReady)
+{
+	OnWildStateChangedNative.Broadcast(bWildReady);
+	ForEachObserver([bWildReady](IOnetBoardObserver& Observer) { Observer.OnWildStateChanged(bWildReady); });
+	OnWildStateChanged.Broadcast(bWildReady);
+}
+
+void UOnetBoardComponent::BroadcastBoardCleared()
+{
+	OnBoardClearedNative.Broadcast();
+	ForEachObserver([](IOnetBoardObserver& Observer) { Observer.OnBoardCleared(); });
+	OnBoardCleared.Broadcast();
+}
+
+void UOnetBoardComponent::BroadcastNoMovesRemain()
+{
+	OnNoMovesRemainNative.Broadcast();
+	ForEachObserver([](IOnetBoardObserver& Observer) { Observer.OnNoMovesRemain(); });
+	OnNoMovesRemain.Broadcast();
+}
+
+void UOnetBoardComponent::BroadcastSolveProgress(const int64 NodesExpanded, const float NodesPerSecond)
+{
+	OnSolveProgressNative.Broadcast(NodesExpanded, NodesPerSecond);
+	ForEachObserver([NodesExpanded, NodesPerSecond](IOnetBoardObserver& Observer)
+	{
+		Observer.OnSolveProgress(NodesExpanded, NodesPerSecond);
+	});
+	OnSolveProgress.Broadcast(NodesExpanded, NodesPerSecond);
+}
+
+void UOnetBoardComponent::BroadcastSolveFinished(const FOnetSolveResult& Result)
+{
+	const float NodesPerSecond = static_cast<float>(Result.NodesPerSecond);
+	OnSolveFinishedNative.Broadcast(Result.Outcome, Result.Moves, Result.NodesExpanded, NodesPerSecond);
+	ForEachObserver([&Result, NodesPerSecond](IOnetBoardObserver& Observer)
+	{
+		Observer.OnSolveFinished(Result.Outcome, Result.Moves, Result.NodesExpanded, NodesPerSecond);
+	});
+	OnSolveFinished.Broadcast(Result.Outcome, Result.Moves, Result.NodesExpanded, NodesPerSecond);
 }
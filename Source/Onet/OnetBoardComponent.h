@@ -4,33 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "OnetBoardCore.h"
+#include "OnetBoardObserver.h"
+#include "OnetBoardTypes.h"
 #include "OnetBoardComponent.generated.h"
 
-/**
- * A single tile on the Onet game board.
- * 
- * Members:
- * - TileTypeId: An integer representing the type of the tile. If not defined, it defaults to INDEX_NONE.
- * - bEmpty: A boolean indicating whether the tile is empty (true) or occupied (false).
- */
-USTRUCT(BlueprintType)
-struct FOnetTile
-{
-	GENERATED_BODY()
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
-	int32 TileTypeId = INDEX_NONE; // Type identifier for the tile. If it is not defined, it is set to INDEX_NONE.
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
-	bool bEmpty = true; // Indicates whether the tile is empty or occupied.
-};
-
 /**
  * Board changed event: UI can listen to this event to update the display.
  * Dynamic multicast makes it bindable in Blueprints.
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnetBoardChanged);
 
+/**
+ * Board delta event: only the listed logical cells changed (see EOnetCellChangeKind).
+ * Lets the UI repaint a couple of tiles after a match instead of the whole board.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnetCellsChanged, EOnetCellChangeKind, Kind,
+                                             const TArray<FIntPoint>&, Cells);
+
 /**
  * Selection changed event.
  * We expose both: whether selection exists, and the coordinates of the second selection (if any).
@@ -38,6 +29,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnetBoardChanged);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnetSelectionChanged, bool, bHasFirstSelection,
                                              FIntPoint, FirstSelection);
 
+/**
+ * Selection partners event: every tile the current first selection can be linked to.
+ * Broadcast with an empty list when the selection is cleared.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnetSelectionPartnersChanged, const TArray<FIntPoint>&, Partners);
+
 /**
  * Match successful event: fired when two tiles are successfully matched.
  * Passes the path that connects the two tiles for animation purposes.
@@ -75,11 +72,45 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnetBoardCleared);
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnetNoMovesRemain);
 
+/**
+ * Solver progress, reported a few times per second while a solve runs.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnetSolveProgress, int64, NodesExpanded, float, NodesPerSecond);
+
+/**
+ * Solver finished event. Moves holds the clearing sequence when Outcome is Solved.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnetSolveFinished, EOnetSolveOutcome, Outcome,
+                                              const TArray<FOnetTilePair>&, Moves, int64, NodesExpanded,
+                                              float, NodesPerSecond);
+
+/**
+ * Native counterparts of the events above, for C++ listeners. They skip reflection on broadcast
+ * and pass arrays as views. Fired right before the Blueprint event of the same name.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnetBoardChangedNative);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnetCellsChangedNative, EOnetCellChangeKind, TConstArrayView<FIntPoint>);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnetSelectionChangedNative, bool, const FIntPoint&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnetSelectionPartnersChangedNative, TConstArrayView<FIntPoint>);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnetMatchSuccessfulNative, TConstArrayView<FIntPoint>);
+DECLARE_MULTICAST_DELEGATE(FOnetMatchFailedNative);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnetShufflePerformedNative, int32, bool);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnetHintUpdatedNative, bool, const FIntPoint&, const FIntPoint&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnetWildStateChangedNative, bool);
+DECLARE_MULTICAST_DELEGATE(FOnetBoardClearedNative);
+DECLARE_MULTICAST_DELEGATE(FOnetNoMovesRemainNative);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnetSolveProgressNative, int64, float);
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnetSolveFinishedNative, EOnetSolveOutcome, TConstArrayView<FOnetTilePair>,
+                                      int64, float);
+
+struct FOnetSolveControl;
+struct FOnetSolveResult;
+
 /**
  * Board component that contains the game logic for Onet.
  * 
  * Responsibilities:
- * - Store board data (tiles)
+ * - Own the board data and rules (FOnetBoardCore) and expose them to Blueprints
  * - Handle selection state machine
  * - Apply match/remove MVP
  * - Broadcast events when the board changes so UI can update
@@ -96,15 +127,21 @@ class ONET_API UOnetBoardComponent : public UActorComponent
 public:
 	UOnetBoardComponent();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Initialize board with size and number of unique tile types.
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
 	void InitializeBoard(int32 InWidth, int32 InHeight, int32 InNumTileTypes);
 
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
-	int32 GetBoardWidth() const { return Width; }
+	int32 GetBoardWidth() const { return Core.GetWidth(); }
 
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
-	int32 GetBoardHeight() const { return Height; }
+	int32 GetBoardHeight() const { return Core.GetHeight(); }
+
+	// Every tile on the board has a type id below this.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetNumTileTypes() const { return Core.GetNumTileTypes(); }
 
 	// Read a tile at (X, Y). Returns false if out of bounds.
 	// UI uses this to render the board.
@@ -120,11 +157,82 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
 	void ClearSelection();
 
+	// Current first selection (logical coordinates). Returns false if nothing is selected.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	bool GetFirstSelection(FIntPoint& OutSelection) const
+	{
+		OutSelection = FirstSelection;
+		return bHasFirstSelection;
+	}
+
+	// Tiles the current first selection can be linked to (logical coordinates).
+	// Returns false if nothing is selected or no partner exists.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	bool GetSelectionPartners(TArray<FIntPoint>& OutPartners) const;
+
 	// Check if two tiles can be linked with at most 2 turns.
 	// Returns true if a valid path exists, and optionally returns the path.
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
 	bool CanLink(int32 X1, int32 Y1, int32 X2, int32 Y2, TArray<FIntPoint>& OutPath) const;
 
+	// 64-bit Zobrist fingerprint of the current tiles (see FOnetZobrist), kept current incrementally.
+	// Equal boards give equal hashes across sessions and machines.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int64 GetBoardHash() const { return static_cast<int64>(Core.GetBoardHash()); }
+
+	// Hash the whole board from scratch; matches GetBoardHash unless the incremental update is broken.
+	uint64 ComputeBoardHash() const { return Core.ComputeBoardHash(); }
+
+	// Monotonic counter bumped by every change to the board (tiles or shuffle charges).
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int64 GetBoardVersion() const { return static_cast<int64>(Core.GetBoardVersion()); }
+
+	// Immutable copy of the board at the current version, safe to hand to other threads.
+	// Repeated calls share one copy until the board changes.
+	FOnetBoardSnapshotRef GetSnapshot() const { return Core.GetSnapshot(); }
+
+	// Whether results computed from Snapshot still describe the board.
+	bool IsSnapshotCurrent(const FOnetBoardSnapshot& Snapshot) const { return Core.IsSnapshotCurrent(Snapshot); }
+
+	// Number of tiles still on the board.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetRemainingTileCount() const { return Core.GetRemainingTileCount(); }
+
+	// Number of tiles left in logical row Y / column X (0 if out of bounds).
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetRowTileCount(int32 Y) const { return Core.GetRowTileCount(Y); }
+
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetColumnTileCount(int32 X) const { return Core.GetColumnTileCount(X); }
+
+	// Bounding rectangle (inclusive, logical coordinates) of the remaining tiles.
+	// Returns false if the board is cleared.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	bool GetLiveBounds(FIntPoint& OutMin, FIntPoint& OutMax) const { return Core.GetLiveBounds(OutMin, OutMax); }
+
+	// Check many candidate pairs against the current board in one pass.
+	// Bit i of OutLinked is set if Pairs[i] can be linked. Paths are only built when OutPaths is given
+	// (OutPaths[i] stays empty for pairs that do not link). Returns the number of linkable pairs.
+	int32 CanLinkBatch(TConstArrayView<FOnetTilePair> Pairs, TBitArray<>& OutLinked,
+	                   TArray<TArray<FIntPoint>>* OutPaths = nullptr) const;
+
+	// Number of currently linkable pairs (kept up to date across removals and shuffles).
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetAvailableMoveCount() const { return Core.GetAvailableMoveCount(); }
+
+	// Copy of every currently linkable pair.
+	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
+	void GetAvailableMoves(TArray<FOnetTilePair>& OutMoves) const;
+
+	// Enumerate every linkable pair from scratch (parallel on large boards; C++ only).
+	void EnumerateAllMoves(TArray<FOnetTilePair>& OutMoves) const { Core.EnumerateAllMoves(OutMoves); }
+
+	// Iterate the currently linkable pairs without copying (C++ only).
+	TArray<FOnetTilePair>::TConstIterator CreateAvailableMoveIterator() const
+	{
+		return Core.GetAvailableMoves().CreateConstIterator();
+	}
+
 	// Retrieve the last failed match attempt (if any).
 	UFUNCTION(BlueprintPure, Category = "Onet|Board")
 	bool GetLastFailedPair(FIntPoint& OutFirst, FIntPoint& OutSecond) const;
@@ -133,7 +241,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
 	bool RequestShuffle();
 
-	// Generate and broadcast a hint pair (if available).
+	// Generate and broadcast a hint pair (if available) through OnHintUpdated, right away.
+	// With solver hints a move from a clearing sequence is precomputed in the background after every
+	// board change; if that search is still running, its move replaces the hint when it lands.
 	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
 	bool RequestHint();
 
@@ -143,28 +253,66 @@ public:
 
 	// Remaining manual/auto shuffles.
 	UFUNCTION(BlueprintPure, Category = "Onet|Board")
-	int32 GetRemainingShuffleUses() const { return RemainingShuffleUses; }
+	int32 GetRemainingShuffleUses() const { return Core.GetRemainingShuffleUses(); }
 
 	// Maximum shuffles allowed per game.
 	UFUNCTION(BlueprintPure, Category = "Onet|Board")
 	int32 GetMaxShuffleUses() const { return MaxShuffleUses; }
 
+	// Seed the current board was generated with; set RandomSeed to it to replay the game.
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	int32 GetRandomSeed() const { return Core.GetRandomSeed(); }
+
+	// Solve the current position on a worker thread. Progress and the result arrive on the game thread
+	// through OnSolveProgress/OnSolveFinished. A running solve is cancelled first (reporting Cancelled);
+	// if the board changes before the result arrives, it is dropped and reported as Stale.
+	UFUNCTION(BlueprintCallable, Category = "Onet|Solver")
+	bool RequestSolve(float TimeBudgetSeconds = 5.0f);
+
+	// Cancel the running solve (if any). OnSolveFinished reports Cancelled at once.
+	UFUNCTION(BlueprintCallable, Category = "Onet|Solver")
+	void CancelSolve();
+
+	UFUNCTION(BlueprintPure, Category = "Onet|Solver")
+	bool IsSolving() const { return ActiveSolve.IsValid(); }
+
+	// Board version the last OnSolveFinished was computed for.
+	UFUNCTION(BlueprintPure, Category = "Onet|Solver")
+	int64 GetLastSolveBoardVersion() const { return static_cast<int64>(LastSolveVersion); }
+
 	// Whether the wild link is primed for the next match.
 	UFUNCTION(BlueprintPure, Category = "Onet|Board")
 	bool IsWildLinkPrimed() const { return bWildLinkPrimed; }
 
+	// Hold back board, cell, selection, partner, shuffle, hint, cleared and no-moves events until the
+	// matching EndNotificationBatch, then send at most one merged notification of each. Batches nest;
+	// an End without a matching Begin is ignored.
+	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
+	void BeginNotificationBatch();
+
+	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
+	void EndNotificationBatch();
+
 	// Query the current hint pair (if any).
 	UFUNCTION(BlueprintPure, Category = "Onet|Board")
 	bool HasActiveHint(FIntPoint& OutFirst, FIntPoint& OutSecond) const;
 
-	// Fired when the board changes (tiles removed, etc.)
+	// Fired when a new board is laid out (possibly with new dimensions); refresh everything.
 	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
 	FOnetBoardChanged OnBoardChanged;
 
+	// Fired when individual cells change (matched pair removed, shuffle). Reset follows every OnBoardChanged.
+	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
+	FOnetCellsChanged OnCellsChanged;
+
 	// Fired when selection changes.
 	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
 	FOnetSelectionChanged OnSelectionChanged;
 
+	// Fired when the set of valid partners for the first selection changes.
+	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
+	FOnetSelectionPartnersChanged OnSelectionPartnersChanged;
+
 	// Fired when two tiles are successfully matched (with path for animation).
 	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
 	FOnetMatchSuccessful OnMatchSuccessful;
@@ -193,26 +341,49 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Onet|Board")
 	FOnetNoMovesRemain OnNoMovesRemain;
 
-private:
-	// Logical dimensions (what UI sees)
-	int32 Width = 0;
-	int32 Height = 0;
+	UPROPERTY(BlueprintAssignable, Category = "Onet|Solver")
+	FOnetSolveProgress OnSolveProgress;
+
+	UPROPERTY(BlueprintAssignable, Category = "Onet|Solver")
+	FOnetSolveFinished OnSolveFinished;
+
+	// Native versions of the events above (C++ only, same order and payloads).
+	FOnetBoardChangedNative OnBoardChangedNative;
+	FOnetCellsChangedNative OnCellsChangedNative;
+	FOnetSelectionChangedNative OnSelectionChangedNative;
+	FOnetSelectionPartnersChangedNative OnSelectionPartnersChangedNative;
+	FOnetMatchSuccessfulNative OnMatchSuccessfulNative;
+	FOnetMatchFailedNative OnMatchFailedNative;
+	FOnetShufflePerformedNative OnShufflePerformedNative;
+	FOnetHintUpdatedNative OnHintUpdatedNative;
+	FOnetWildStateChangedNative OnWildStateChangedNative;
+	FOnetBoardClearedNative OnBoardClearedNative;
+	FOnetNoMovesRemainNative OnNoMovesRemainNative;
+	FOnetSolveProgressNative OnSolveProgressNative;
+	FOnetSolveFinishedNative OnSolveFinishedNative;
+
+	// Register a C++ observer for every board event (ignored if already registered).
+	// The component keeps a raw pointer: remove the observer before it is destroyed. Removing it from
+	// inside a notification is fine; it receives no further calls, not even for the current event.
+	void AddObserver(IOnetBoardObserver* Observer);
+	void RemoveObserver(IOnetBoardObserver* Observer);
 
-	// Physical dimensions (includes padding)
-	// PhysicalWidth = Width + 2, PhysicalHeight = Height + 2
-	// The outer ring is always empty, allowing paths to go around the board edges.
-	int32 PhysicalWidth = 0;
-	int32 PhysicalHeight = 0;
-
-	// Store tile in 1D array for simplicity and better cache-friendliness.
-	// Index = PhysY * PhysicalWidth + PhysX (using physical coordinates)
-	UPROPERTY()
-	TArray<FOnetTile> Tiles;
+private:
+	// Board data and rules; everything below is interaction state layered on top of it.
+	FOnetBoardCore Core;
 
 	// Simple selection state for MVP: one "first selection" remembered.
 	bool bHasFirstSelection = false;
 	FIntPoint FirstSelection = FIntPoint(-1, -1);
 
+	// Cells the first selection can reach within two turns (Core cell index bits).
+	// Flooded on the first click and invalidated as soon as the board changes.
+	TBitArray<> SelectionReach;
+	bool bSelectionReachValid = false;
+
+	// Same-type tiles in SelectionReach (logical coordinates).
+	TArray<FIntPoint> SelectionPartners;
+
 	// Delay before removing matched tiles (in seconds).
 	// This allows time for the connection line animation to play.
 	UPROPERTY(EditDefaultsOnly, Category = "Onet|Board")
@@ -228,12 +399,41 @@ private:
 	// Flag to prevent new selections while processing a match.
 	bool bIsProcessingMatch = false;
 
+	// Layout strategy used by InitializeBoard.
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	EOnetBoardGeneration BoardGeneration = EOnetBoardGeneration::RandomBag;
+
+	// Boards with at least this many logical cells run move searches and shuffle candidate scoring
+	// on worker threads (0 = never).
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	int32 ParallelSearchMinCells = 4096;
+
+	// Boards with at least this many logical cells switch to chunked tile storage and reach-based
+	// move searches, and keep an odd cell count instead of losing a row (0 = never).
+	UPROPERTY(EditAnywhere, Category = "Onet|Board", meta = (ClampMin = "0"))
+	int32 LargeBoardMinCells = 262144;
+
+	// Seed for board generation and shuffles, for reproducible games (0 = new seed every game).
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	int32 RandomSeed = 0;
+
 	// Max shuffle uses per game (manual + auto).
 	UPROPERTY(EditAnywhere, Category = "Onet|Board")
 	int32 MaxShuffleUses = 3;
 
-	// Remaining shuffle charges.
-	int32 RemainingShuffleUses = 0;
+	// Redistribution strategy used by every shuffle (manual and auto).
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	EOnetShuffleMode ShuffleMode = EOnetShuffleMode::Random;
+
+	// Linkable pairs a GuaranteedMoves shuffle seeds (clamped to what the board edges can hold).
+	UPROPERTY(EditAnywhere, Category = "Onet|Board",
+		meta = (ClampMin = "1", EditCondition = "ShuffleMode == EOnetShuffleMode::GuaranteedMoves"))
+	int32 ShuffleGuaranteedMoves = 1;
+
+	// Random permutations a BestOfCandidates shuffle generates and scores.
+	UPROPERTY(EditAnywhere, Category = "Onet|Board",
+		meta = (ClampMin = "1", EditCondition = "ShuffleMode == EOnetShuffleMode::BestOfCandidates"))
+	int32 ShuffleCandidateCount = 8;
 
 	// Wild link primed flag.
 	bool bWildLinkPrimed = false;
@@ -243,6 +443,34 @@ private:
 	FIntPoint HintTileA = FIntPoint(-1, -1);
 	FIntPoint HintTileB = FIntPoint(-1, -1);
 
+	// Cancellation flag of the running solve, shared with the worker (null when idle).
+	TSharedPtr<FOnetSolveControl, ESPMode::ThreadSafe> ActiveSolve;
+
+	// Board version the running solve started from, and the one the last reported result describes.
+	uint64 ActiveSolveVersion = 0;
+	uint64 LastSolveVersion = 0;
+
+	// Hint with a move from a solver clearing sequence, so following hints never strands the board.
+	// Falls back to any available move when the search fails or runs out of time. Costs a background
+	// solve per board change, so large boards (LargeBoardMinCells) never run it.
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	bool bUseSolverHints = false;
+
+	// Time budget of one background hint search.
+	UPROPERTY(EditAnywhere, Category = "Onet|Board", meta = (ClampMin = "0.01", EditCondition = "bUseSolverHints"))
+	float HintSearchBudgetSeconds = 0.25f;
+
+	// Running background hint search (null when idle).
+	TSharedPtr<FOnetSolveControl, ESPMode::ThreadSafe> ActiveHintSearch;
+
+	// Precomputed hint for board version SpeculativeHintVersion.
+	bool bHasSpeculativeHint = false;
+	FOnetTilePair SpeculativeHint;
+	uint64 SpeculativeHintVersion = 0;
+
+	// RequestHint arrived while the search was running; upgrade its hint when the search finishes.
+	bool bHintRequestPending = false;
+
 	// Guard to avoid recursive deadlock checks.
 	bool bResolvingDeadlock = false;
 
@@ -251,35 +479,59 @@ private:
 	FIntPoint LastFailedTileA = FIntPoint(-1, -1);
 	FIntPoint LastFailedTileB = FIntPoint(-1, -1);
 
-	// Convert logical coordinate to physical coordinate (add padding offset)
-	FIntPoint LogicalToPhysical(const FIntPoint& Logical) const
-	{
-		return FIntPoint(Logical.X + 1, Logical.Y + 1);
-	}
+	// Merge every notification of a frame into one batch, sent on the next tick.
+	// Match, wild link and solver events are never held back.
+	UPROPERTY(EditAnywhere, Category = "Onet|Board")
+	bool bBatchNotificationsPerFrame = false;
 
-	// Convert logical coordinates to physical index in Tiles array
-	int32 LogicalToPhysicalIndex(const int32 X, const int32 Y) const
+	// Notifications recorded while a batch is open; only the merged end state is kept.
+	struct FPendingNotifications
 	{
-		return (Y + 1) * PhysicalWidth + (X + 1);
-	}
+		bool bBoardChanged = false;
 
-	// Convert physical coordinates to index in Tiles array
-	int32 PhysicalToIndex(const int32 PhysX, const int32 PhysY) const
-	{
-		return PhysY * PhysicalWidth + PhysX;
-	}
+		// Union of the changed cells (one bit per logical cell, Y * Width + X). Removed only if
+		// every recorded change was a removal.
+		bool bCellsChanged = false;
+		bool bOnlyRemovals = true;
+		TBitArray<> ChangedCells;
 
-	// Check if physical coordinates are in bounds
-	bool IsPhysicalInBounds(const int32 PhysX, const int32 PhysY) const
-	{
-		return PhysX >= 0 && PhysX < PhysicalWidth && PhysY >= 0 && PhysY < PhysicalHeight;
-	}
+		bool bSelectionChanged = false;
+		bool bHasFirstSelection = false;
+		FIntPoint FirstSelection = FIntPoint(-1, -1);
 
-	// Check if logical coordinates are in bounds
-	bool IsInBonds(const int32 X, const int32 Y) const
-	{
-		return X >= 0 && X < Width && Y >= 0 && Y < Height;
-	}
+		bool bSelectionPartnersChanged = false;
+
+		bool bShufflePerformed = false;
+		bool bShuffleAutoTriggered = false;
+
+		bool bHintUpdated = false;
+		bool bHasHint = false;
+		FIntPoint HintFirst = FIntPoint(-1, -1);
+		FIntPoint HintSecond = FIntPoint(-1, -1);
+
+		bool bBoardCleared = false;
+		bool bNoMovesRemain = false;
+	};
+
+	FPendingNotifications PendingNotifications;
+
+	// Open explicit batches (BeginNotificationBatch); the per-frame batch is tracked by bFrameBatchOpen.
+	int32 NotificationBatchDepth = 0;
+
+	// Registered C++ observers (not owned). Removals during a dispatch leave a null entry behind,
+	// compacted once the outermost dispatch returns.
+	TArray<IOnetBoardObserver*> Observers;
+	int32 ObserverDispatchDepth = 0;
+
+	// A per-frame batch is open and its flush is scheduled for the next tick.
+	bool bFrameBatchOpen = false;
+
+	// Next-tick timer callback: close the per-frame batch, flushing unless an explicit batch is still open.
+	void EndFrameNotificationBatch();
+
+	// Flood/clear the reach set of the first selection and notify its partners.
+	void UpdateSelectionReach();
+	void ResetSelectionReach();
 
 	// Called by timer to actually remove the matched tiles.
 	void RemoveMatchedTiles();
@@ -290,12 +542,78 @@ private:
 	// Check whether the board has any valid moves; auto-shuffle if allowed.
 	void CheckForDeadlockAndShuffleIfNeeded();
 
-	// Search the board for any valid match.
-	bool FindFirstAvailableMatch(FIntPoint& OutTileA, FIntPoint& OutTileB, TArray<FIntPoint>& OutPath) const;
+	// Solve the current snapshot on the thread pool. OnFinished runs on the game thread with the
+	// snapshot's board version, even if the board moved on; OnProgress runs on the solving thread.
+	void StartBackgroundSolve(const TSharedRef<FOnetSolveControl, ESPMode::ThreadSafe>& Control,
+	                          float TimeBudgetSeconds, TFunction<void(const FOnetSolveResult&, uint64)> OnFinished,
+	                          TFunction<void(int64, double)> OnProgress = nullptr);
+
+	// Call after any change made through Core; cancels hint work on the old board version.
+	void MarkBoardChanged();
+
+	// Copy the editor-facing rule properties into Core.Rules.
+	void SyncCoreRules();
+
+	// Speculative hint search: start it once the board has settled, cancel it whenever the board changes.
+	void StartSpeculativeHint();
+	void CancelSpeculativeHint();
+
+	// Broadcast the best hint available right now (speculative, else the move index).
+	bool DeliverHint();
 
 	// Clear cached hint state and notify UI if needed.
 	void ClearHintState();
 
-	// Return true if all logical tiles are empty.
-	bool IsBoardCleared() const;
+	// Broadcast now, or record into PendingNotifications while a batch is open.
+	void NotifyBoardChanged();
+	void NotifyCellsChanged(EOnetCellChangeKind Kind, const TArray<FIntPoint>& Cells);
+	void NotifySelectionChanged(bool bHasSelection, const FIntPoint& Selection);
+	void NotifySelectionPartnersChanged();
+	void NotifyShufflePerformed(bool bAutoTriggered);
+	void NotifyHintUpdated(bool bHasHint, const FIntPoint& First, const FIntPoint& Second);
+	void NotifyBoardCleared();
+	void NotifyNoMovesRemain();
+
+	// Whether notifications are held back right now (opens the per-frame batch if enabled).
+	bool ShouldDeferNotification();
+
+	// Send the merged pending notifications and reset the record.
+	void FlushNotifications();
+
+	// Fire one event on every surface: native delegate, observers, then the Blueprint delegate.
+	void BroadcastBoardChanged();
+	void BroadcastCellsChanged(EOnetCellChangeKind Kind, const TArray<FIntPoint>& Cells);
+	void BroadcastSelectionChanged(bool bHasSelection, const FIntPoint& Selection);
+	void BroadcastSelectionPartnersChanged();
+	void BroadcastMatchSuccessful(const TArray<FIntPoint>& Path);
+	void BroadcastMatchFailed();
+	void BroadcastShufflePerformed(bool bAutoTriggered);
+	void BroadcastHintUpdated(bool bHasHint, const FIntPoint& First, const FIntPoint& Second);
+	void BroadcastWildStateChanged(bool bWildReady);
+	void BroadcastBoardCleared();
+	void BroadcastNoMovesRemain();
+	void BroadcastSolveProgress(int64 NodesExpanded, float NodesPerSecond);
+	void BroadcastSolveFinished(const FOnetSolveResult& Result);
+
+	// Call Func on every live observer. Walks the live list by index, so an observer removed (or
+	// destroyed after removing itself) mid-dispatch is skipped; observers added meanwhile wait for
+	// the next event.
+	template <typename FuncType>
+	void ForEachObserver(const FuncType& Func)
+	{
+		++ObserverDispatchDepth;
+		const int32 NumObservers = Observers.Num();
+		for (int32 Index = 0; Index < NumObservers; ++Index)
+		{
+			if (IOnetBoardObserver* Observer = Observers[Index])
+			{
+				Func(*Observer);
+			}
+		}
+
+		if (--ObserverDispatchDepth == 0)
+		{
+			Observers.Remove(nullptr);
+		}
+	}
 };
@@ -0,0 +1,1281 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardCore.h"
+#include "OnetBoardHash.h"
+#include "Async/ParallelFor.h"
+
+#include <atomic>
+
+/**
+ * Initialize the board with given dimensions and number of tile types.
+ * 
+ * @param InWidth - Width of the board in tiles.
+ * @param InHeight - Height of the board in tiles.
+ * @param InNumTileTypes - Number of unique tile types to use.
+ * @return - Number of unique tile types actually placed.
+ */
+int32 FOnetBoardCore::Initialize(const int32 InWidth, const int32 InHeight, const int32 InNumTileTypes)
+{
+	// Every random choice below and in later shuffles comes from this stream.
+	if (Rules.RandomSeed != 0)
+	{
+		RandomStream.Initialize(Rules.RandomSeed);
+	}
+	else
+	{
+		RandomStream.GenerateNewSeed();
+	}
+
+	// Ensure minimum logical dimensions of 1x1
+	Width = FMath::Max(1, InWidth);
+	Height = FMath::Max(1, InHeight);
+
+	int32 NumCells = Width * Height;
+	const bool bLargeBoard = IsLargeBoard();
+
+	// Onet game requires pairs, so total cells should be even.
+	// For MVP, if odd, we shrink the board by one row to make it even; large boards keep their size
+	// and leave the last cell empty instead.
+	if (NumCells % 2 != 0 && !bLargeBoard)
+	{
+		UE_LOG(LogTemp, Error, TEXT("NumCells must be a multiple of 2. Shrinking height by 1 for MVP."));
+		Height = FMath::Max(1, Height - 1);
+		NumCells = Width * Height;
+	}
+
+	// Set physical dimensions with padding (1 tile border on all sides)
+	PhysicalWidth = Width + 2;
+	PhysicalHeight = Height + 2;
+
+	// Each pair occupies 2 cells.
+	const int32 NumPairs = NumCells / 2;
+
+	// Clamp unique types so that each type has at least one pair.
+	const int32 NumUniqueTypes = FMath::Clamp(InNumTileTypes, 1, FMath::Min(NumPairs, FOnetTileStorage::MaxTypes));
+
+	// Allocate physical board (includes padding), every cell empty.
+	Tiles.Reset(PhysicalWidth, PhysicalHeight, NumUniqueTypes, bLargeBoard);
+
+	if (Rules.BoardGeneration == EOnetBoardGeneration::SolvableByConstruction)
+	{
+		// One entry per pair; shuffled so that types are spread over the construction order.
+		TArray<int32> PairTypes;
+		PairTypes.Reserve(NumPairs);
+		for (int32 i = 0; i < NumPairs; i++)
+		{
+			PairTypes.Add(i % NumUniqueTypes);
+		}
+
+		for (int32 i = PairTypes.Num() - 1; i > 0; i--)
+		{
+			const int32 SwapIndex = RandomStream.RandRange(0, i);
+			if (i != SwapIndex)
+			{
+				PairTypes.Swap(i, SwapIndex);
+			}
+		}
+
+		PopulateSolvableLayout(PairTypes);
+	}
+	else
+	{
+		// Build a bag of tile types: each type appears exactly twice.
+		// Then shuffle it to randomize placement.
+		TArray<int32> TypeBag;
+		TypeBag.Reserve(NumCells);
+
+		for (int32 i = 0; i < NumPairs; i++)
+		{
+			const int32 TypeId = i % NumUniqueTypes;
+			// Add twice for the pair
+			TypeBag.Add(TypeId);
+			TypeBag.Add(TypeId);
+		}
+
+		// Fisher-Yates shuffle
+		for (int32 i = TypeBag.Num() - 1; i > 0; i--)
+		{
+			const int32 SwapIndex = RandomStream.RandRange(0, i);
+			if (i != SwapIndex) // Avoid unnecessary swap
+			{
+				TypeBag.Swap(i, SwapIndex);
+			}
+		}
+
+		// Populate only the inner logical region (skip padding)
+		int32 BagIndex = 0;
+		for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+		{
+			for (int32 LogicX = 0; LogicX < Width && BagIndex < TypeBag.Num(); ++LogicX)
+			{
+				Tiles.SetType(LogicX + 1, LogicY + 1, TypeBag[BagIndex]);
+				BagIndex++;
+			}
+		}
+	}
+
+	RemainingShuffleUses = Rules.MaxShuffleUses;
+
+	// Derived lookup structures mirror the freshly populated tiles.
+	RebuildBoardCaches();
+
+	return NumUniqueTypes;
+}
+
+/**
+ * Read a tile at (X, Y). Returns false if out of bounds.
+ * 
+ * @param X - X coordinate of the tile.
+ * @param Y - Y coordinate of the tile.
+ * @param OutTile - Output parameter to receive the tile data.
+ * @return - True if the tile is valid and returned, false if out of bounds.
+ */
+bool FOnetBoardCore::GetTile(const int32 X, const int32 Y, FOnetTile& OutTile) const
+{
+	// Check logical bounds
+	if (!IsInBounds(X, Y))
+	{
+		return false; // Out of bounds
+	}
+
+	// Convert to physical index and retrieve tile
+	const int32 PhysIndex = LogicalToPhysicalIndex(X, Y);
+	OutTile = Tiles.GetTile(PhysIndex);
+	return true;
+}
+
+/**
+ * Check if two tiles can be linked with at most 2 turns.
+ * The path can only go through empty tiles (or the start/end tiles).
+ *
+ * Every valid link has the shape Start -> CornerA -> CornerB -> End, where the middle leg
+ * runs along a shared row or column (straight lines and single corners are degenerate cases).
+ * Instead of a BFS we scan those corridors directly, which needs no heap allocation.
+ *
+ * @param X1, Y1 - Coordinates of the first tile.
+ * @param X2, Y2 - Coordinates of the second tile.
+ * @param OutPath - Output parameter to receive the path points.
+ * @return True if a valid path exists with at most 2 turns.
+ */
+bool FOnetBoardCore::CanLink(const int32 X1, const int32 Y1, const int32 X2, const int32 Y2,
+                             TArray<FIntPoint>& OutPath) const
+{
+	OutPath.Reset();
+
+	// Same position is not a valid link.
+	if (X1 == X2 && Y1 == Y2)
+	{
+		return false;
+	}
+
+	// Check if both tiles are in logical bounds and not empty.
+	if (!IsInBounds(X1, Y1) || !IsInBounds(X2, Y2))
+	{
+		return false;
+	}
+
+	const int32 Index1 = LogicalToPhysicalIndex(X1, Y1);
+	const int32 Index2 = LogicalToPhysicalIndex(X2, Y2);
+
+	if (Tiles.IsEmpty(Index1) || Tiles.IsEmpty(Index2))
+	{
+		return false;
+	}
+
+	// Check if tiles have the same type.
+	if (Tiles.GetType(Index1) != Tiles.GetType(Index2))
+	{
+		return false;
+	}
+
+	// Convert logical coordinates to physical for pathfinding
+	const FIntPoint PhysStart = LogicalToPhysical(FIntPoint(X1, Y1));
+	const FIntPoint PhysEnd = LogicalToPhysical(FIntPoint(X2, Y2));
+
+	FIntPoint CornerA;
+	FIntPoint CornerB;
+	if (!FindLinkCorners(PhysStart, PhysEnd, CornerA, CornerB))
+	{
+		return false;
+	}
+
+	BuildLinkPath(PhysStart, CornerA, CornerB, PhysEnd, OutPath);
+	return true;
+}
+
+/**
+ * Check many candidate pairs against one board state.
+ * Board validation happens once per batch; each pair then only costs its cell checks and the corridor scan.
+ *
+ * @param Pairs - Candidate pairs in logical coordinates.
+ * @param OutLinked - Receives one bit per pair (true = linkable).
+ * @param OutPaths - Optional; receives the path for every linkable pair.
+ * @return Number of linkable pairs.
+ */
+int32 FOnetBoardCore::CanLinkBatch(const TConstArrayView<FOnetTilePair> Pairs, TBitArray<>& OutLinked,
+                                   TArray<TArray<FIntPoint>>* OutPaths) const
+{
+	OutLinked.Init(false, Pairs.Num());
+	if (OutPaths)
+	{
+		OutPaths->Reset();
+		OutPaths->SetNum(Pairs.Num());
+	}
+
+	if (Width <= 0 || Height <= 0 || Tiles.Num() == 0)
+	{
+		return 0;
+	}
+
+	int32 NumLinked = 0;
+	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
+	{
+		const FIntPoint& A = Pairs[PairIndex].First;
+		const FIntPoint& B = Pairs[PairIndex].Second;
+		if (A == B || !IsInBounds(A.X, A.Y) || !IsInBounds(B.X, B.Y))
+		{
+			continue;
+		}
+
+		const int32 TypeA = Tiles.GetType(LogicalToPhysicalIndex(A.X, A.Y));
+		if (TypeA == INDEX_NONE || TypeA != Tiles.GetType(LogicalToPhysicalIndex(B.X, B.Y)))
+		{
+			continue;
+		}
+
+		const FIntPoint PhysA = LogicalToPhysical(A);
+		const FIntPoint PhysB = LogicalToPhysical(B);
+		FIntPoint CornerA;
+		FIntPoint CornerB;
+		if (!FindLinkCorners(PhysA, PhysB, CornerA, CornerB))
+		{
+			continue;
+		}
+
+		OutLinked[PairIndex] = true;
+		++NumLinked;
+
+		if (OutPaths)
+		{
+			BuildLinkPath(PhysA, CornerA, CornerB, PhysB, (*OutPaths)[PairIndex]);
+		}
+	}
+
+	return NumLinked;
+}
+
+bool FOnetBoardCore::FindLinkPath(const FIntPoint& A, const FIntPoint& B, TArray<FIntPoint>& OutPath) const
+{
+	OutPath.Reset();
+
+	const FIntPoint PhysA = LogicalToPhysical(A);
+	const FIntPoint PhysB = LogicalToPhysical(B);
+	FIntPoint CornerA;
+	FIntPoint CornerB;
+	if (!FindLinkCorners(PhysA, PhysB, CornerA, CornerB))
+	{
+		return false;
+	}
+
+	BuildLinkPath(PhysA, CornerA, CornerB, PhysB, OutPath);
+	return true;
+}
+
+/**
+ * Find the shortest link (in steps) between two physical cells with at most 2 turns.
+ * Tile types and occupancy of the endpoints are not checked here.
+ *
+ * @param PhysStart, PhysEnd - Physical coordinates of the two endpoints.
+ * @param OutCornerA, OutCornerB - Receive the two corners of the winning corridor.
+ * @return True if any corridor is free.
+ */
+bool FOnetBoardCore::FindLinkCorners(const FIntPoint& PhysStart, const FIntPoint& PhysEnd,
+                                     FIntPoint& OutCornerA, FIntPoint& OutCornerB) const
+{
+	// Cheap rejection: the tiles must touch or border a common empty region.
+	if (!EmptyRegions.MayConnect(PhysStart, PhysEnd))
+	{
+		return false;
+	}
+
+	return FreeRuns.FindCorridor(LiveBoundsMin + FIntPoint(1, 1), LiveBoundsMax + FIntPoint(1, 1), PhysStart, PhysEnd,
+	                             OutCornerA, OutCornerB);
+}
+
+/**
+ * Expand a corridor into the cell-by-cell path (logical coordinates) the UI expects.
+ */
+void FOnetBoardCore::BuildLinkPath(const FIntPoint& PhysStart, const FIntPoint& CornerA,
+                                   const FIntPoint& CornerB, const FIntPoint& PhysEnd,
+                                   TArray<FIntPoint>& OutPath)
+{
+	const FIntPoint Points[] = {PhysStart, CornerA, CornerB, PhysEnd};
+
+	int32 NumCells = 1;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		NumCells += FMath::Abs(Points[i + 1].X - Points[i].X) + FMath::Abs(Points[i + 1].Y - Points[i].Y);
+	}
+
+	OutPath.Reset(NumCells);
+	OutPath.Add(FIntPoint(PhysStart.X - 1, PhysStart.Y - 1)); // Convert to logical
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const FIntPoint Step(FMath::Sign(Points[i + 1].X - Points[i].X), FMath::Sign(Points[i + 1].Y - Points[i].Y));
+		FIntPoint Cursor = Points[i];
+		while (Cursor != Points[i + 1])
+		{
+			Cursor += Step;
+			OutPath.Add(FIntPoint(Cursor.X - 1, Cursor.Y - 1)); // Convert to logical
+		}
+	}
+}
+
+/**
+ * Mark every cell that a tile at Logical can link to with at most 2 turns (see
+ * FOnetFreeRunTable::ForEachReachableCell). O(Width * Height) at worst, usually a few dozen rays.
+ *
+ * @param Logical - Coordinates of the start tile.
+ * @param OutReach - Receives one bit per cell index (true = reachable occupied cell, see GetCellIndex).
+ */
+void FOnetBoardCore::ComputeReachableCells(const FIntPoint& Logical, TBitArray<>& OutReach) const
+{
+	OutReach.Init(false, Tiles.Num());
+	const FIntPoint PhysStart = LogicalToPhysical(Logical);
+
+	FreeRuns.ForEachReachableCell(LiveBoundsMin + FIntPoint(1, 1), LiveBoundsMax + FIntPoint(1, 1), PhysStart,
+	                              [this, &OutReach](const int32 X, const int32 Y)
+	                              {
+		                              OutReach[PhysicalToIndex(X, Y)] = true;
+	                              });
+
+	OutReach[PhysicalToIndex(PhysStart.X, PhysStart.Y)] = false;
+}
+
+/**
+ * Remove a matched pair. Only tiles the freed cells can reach are searched for new moves.
+ *
+ * @param A, B - Logical coordinates of the two tiles.
+ */
+void FOnetBoardCore::RemovePair(const FIntPoint& A, const FIntPoint& B)
+{
+	const FIntPoint FreedCells[] = {A, B};
+	ClearTile(A);
+	ClearTile(B);
+
+	RefreshMoveIndex(MakeArrayView(FreedCells));
+	checkSlow(BoardHash == ComputeBoardHash());
+}
+
+/**
+ * Redistribute the remaining tiles over the board with the current shuffle mode.
+ *
+ * @param OutChangedCells - Optional, receives the logical cells whose type changed (emptied or filled included).
+ * @return False if the board is empty or no shuffle charge is left.
+ */
+bool FOnetBoardCore::Shuffle(TArray<FIntPoint>* OutChangedCells)
+{
+	if (Width <= 0 || Height <= 0 || Tiles.Num() == 0)
+	{
+		return false;
+	}
+
+	if (RemainingShuffleUses <= 0)
+	{
+		return false;
+	}
+
+	// Collect remaining tile types and logical slots (and the old layout, if a diff was asked for).
+	TArray<int32> RemainingTypes;
+	TArray<FIntPoint> LogicalSlots;
+	TArray<int32> PreviousTypes;
+	RemainingTypes.Reserve(Width * Height);
+	LogicalSlots.Reserve(Width * Height);
+	if (OutChangedCells)
+	{
+		PreviousTypes.Reserve(Width * Height);
+	}
+
+	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+	{
+		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		{
+			const int32 TypeId = Tiles.GetType(LogicX + 1, LogicY + 1);
+			if (TypeId != INDEX_NONE)
+			{
+				RemainingTypes.Add(TypeId);
+			}
+			if (OutChangedCells)
+			{
+				PreviousTypes.Add(TypeId);
+			}
+
+			// Reset tile to empty before reassigning.
+			Tiles.SetType(LogicX + 1, LogicY + 1, INDEX_NONE);
+			LogicalSlots.Add(FIntPoint(LogicX, LogicY));
+		}
+	}
+
+	// Shuffle types and slot order.
+	for (int32 i = RemainingTypes.Num() - 1; i > 0; --i)
+	{
+		const int32 SwapIndex = RandomStream.RandRange(0, i);
+		if (i != SwapIndex)
+		{
+			RemainingTypes.Swap(i, SwapIndex);
+		}
+	}
+
+	for (int32 i = LogicalSlots.Num() - 1; i > 0; --i)
+	{
+		const int32 SwapIndex = RandomStream.RandRange(0, i);
+		if (i != SwapIndex)
+		{
+			LogicalSlots.Swap(i, SwapIndex);
+		}
+	}
+
+	// Refill board.
+	if (Rules.ShuffleMode == EOnetShuffleMode::GuaranteedMoves)
+	{
+		PopulateGuaranteedShuffle(RemainingTypes, LogicalSlots);
+	}
+	else
+	{
+		if (Rules.ShuffleMode == EOnetShuffleMode::BestOfCandidates)
+		{
+			SelectBestShuffleCandidate(RemainingTypes, LogicalSlots);
+		}
+
+		const int32 NumToPlace = FMath::Min(RemainingTypes.Num(), LogicalSlots.Num());
+		for (int32 i = 0; i < NumToPlace; ++i)
+		{
+			const FIntPoint& Slot = LogicalSlots[i];
+			Tiles.SetType(Slot.X + 1, Slot.Y + 1, RemainingTypes[i]);
+		}
+	}
+
+	if (OutChangedCells)
+	{
+		OutChangedCells->Reset();
+		for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+		{
+			for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+			{
+				if (Tiles.GetType(LogicX + 1, LogicY + 1) != PreviousTypes[LogicY * Width + LogicX])
+				{
+					OutChangedCells->Add(FIntPoint(LogicX, LogicY));
+				}
+			}
+		}
+	}
+
+	RemainingShuffleUses = FMath::Max(0, RemainingShuffleUses - 1);
+	RebuildBoardCaches();
+	return true;
+}
+
+bool FOnetBoardCore::ResolveDeadlock()
+{
+	while (IsDeadlocked())
+	{
+		if (!Shuffle())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Lay out pairs in reverse removal order so that the board can always be cleared.
+ *
+ * The logical region is swept line by line (rows or columns, in a random direction).
+ * While a line is filled, the next line of the sweep is still completely empty (for the
+ * last line this is the padded ring), so:
+ * - Any two cells of the current line link through it: out, along, back in (two turns).
+ * - A cell left over from the previous line links to any cell of the fresh current line
+ *   (one step into the line, then along it).
+ * Removing the pairs in reverse placement order therefore replays these states backwards,
+ * and every pair is linkable at the moment it is removed. Partners within a line are random,
+ * and PairTypes is expected to be shuffled, so the pairs are not visible from the layout.
+ * Runs in O(Width * Height) with no retries or verification pass.
+ *
+ * @param PairTypes - Tile type of every pair, NumCells / 2 entries.
+ */
+void FOnetBoardCore::PopulateSolvableLayout(const TConstArrayView<int32> PairTypes)
+{
+	check(PairTypes.Num() == Width * Height / 2);
+
+	const bool bSweepRows = RandomStream.RandRange(0, 1) == 1;
+	const bool bReverseSweep = RandomStream.RandRange(0, 1) == 1;
+	const int32 NumLines = bSweepRows ? Height : Width;
+	const int32 LineLength = bSweepRows ? Width : Height;
+
+	auto LineCellToLogical = [&](const int32 Line, const int32 Position)
+	{
+		const int32 SweepLine = bReverseSweep ? NumLines - 1 - Line : Line;
+		return bSweepRows ? FIntPoint(Position, SweepLine) : FIntPoint(SweepLine, Position);
+	};
+
+	int32 PairIndex = 0;
+	auto PlacePair = [&](const FIntPoint& A, const FIntPoint& B)
+	{
+		const int32 TypeId = PairTypes[PairIndex++];
+		for (const FIntPoint& Cell : {A, B})
+		{
+			Tiles.SetType(Cell.X + 1, Cell.Y + 1, TypeId);
+		}
+	};
+
+	TArray<int32> Positions;
+	Positions.SetNumUninitialized(LineLength);
+
+	bool bHasLeftover = false;
+	FIntPoint Leftover = FIntPoint(-1, -1);
+
+	for (int32 Line = 0; Line < NumLines; ++Line)
+	{
+		// Random visiting order of the line's cells (Fisher-Yates).
+		for (int32 i = 0; i < LineLength; ++i)
+		{
+			Positions[i] = i;
+		}
+		for (int32 i = LineLength - 1; i > 0; i--)
+		{
+			const int32 SwapIndex = RandomStream.RandRange(0, i);
+			if (i != SwapIndex)
+			{
+				Positions.Swap(i, SwapIndex);
+			}
+		}
+
+		int32 Next = 0;
+
+		// The previous line's odd cell must be paired before anything else lands in this line.
+		if (bHasLeftover)
+		{
+			PlacePair(Leftover, LineCellToLogical(Line, Positions[Next++]));
+			bHasLeftover = false;
+		}
+
+		for (; Next + 1 < LineLength; Next += 2)
+		{
+			PlacePair(LineCellToLogical(Line, Positions[Next]), LineCellToLogical(Line, Positions[Next + 1]));
+		}
+
+		if (Next < LineLength)
+		{
+			Leftover = LineCellToLogical(Line, Positions[Next]);
+			bHasLeftover = true;
+		}
+	}
+
+	// An odd board keeps its very last cell empty; the extra gap only makes removals easier.
+	check(bHasLeftover == ((Width * Height) % 2 != 0) && PairIndex == PairTypes.Num());
+}
+
+/**
+ * Rebuild every derived lookup structure from Tiles.
+ * Called after the whole board is (re)populated: Initialize and Shuffle.
+ */
+void FOnetBoardCore::RebuildBoardCaches()
+{
+	++BoardVersion;
+
+	// Occupancy bits only seed the free runs and empty regions; removals update those directly.
+	FOnetOccupancyMask Occupancy;
+	Occupancy.Reset(PhysicalWidth, PhysicalHeight);
+
+	TArray<int32> CellTypes;
+	CellTypes.Init(INDEX_NONE, Tiles.Num());
+
+	RemainingTileCount = 0;
+	RowTileCounts.Reset();
+	RowTileCounts.SetNumZeroed(Height);
+	ColumnTileCounts.Reset();
+	ColumnTileCounts.SetNumZeroed(Width);
+	LiveBoundsMin = FIntPoint(MAX_int32, MAX_int32);
+	LiveBoundsMax = FIntPoint(-1, -1);
+	BoardHash = 0;
+
+	// Storage order; the chunked layout skips chunks without tiles.
+	Tiles.ForEachTile([this, &Occupancy, &CellTypes](const int32 PhysX, const int32 PhysY, const int32 TypeId)
+	{
+		const int32 LogicX = PhysX - 1;
+		const int32 LogicY = PhysY - 1;
+
+		Occupancy.SetOccupied(PhysX, PhysY, true);
+		CellTypes[PhysicalToIndex(PhysX, PhysY)] = TypeId;
+
+		BoardHash ^= FOnetZobrist::GetTileKey(LogicX, LogicY, TypeId);
+
+		++RemainingTileCount;
+		++RowTileCounts[LogicY];
+		++ColumnTileCounts[LogicX];
+		LiveBoundsMin = LiveBoundsMin.ComponentMin(FIntPoint(LogicX, LogicY));
+		LiveBoundsMax = LiveBoundsMax.ComponentMax(FIntPoint(LogicX, LogicY));
+	});
+
+	if (RemainingTileCount == 0)
+	{
+		LiveBoundsMin = FIntPoint(-1, -1);
+	}
+
+	FreeRuns.Rebuild(Occupancy);
+	EmptyRegions.Rebuild(Occupancy);
+	TypeBuckets.Rebuild(CellTypes);
+	RebuildMoveIndex();
+}
+
+uint64 FOnetBoardCore::ComputeBoardHash() const
+{
+	uint64 Hash = 0;
+	Tiles.ForEachTile([&Hash](const int32 PhysX, const int32 PhysY, const int32 TypeId)
+	{
+		Hash ^= FOnetZobrist::GetTileKey(PhysX - 1, PhysY - 1, TypeId);
+	});
+	return Hash;
+}
+
+FOnetBoardSnapshotRef FOnetBoardCore::GetSnapshot() const
+{
+	if (!CachedSnapshot.IsValid() || CachedSnapshot->Version != BoardVersion)
+	{
+		const TSharedRef<FOnetBoardSnapshot, ESPMode::ThreadSafe> Snapshot =
+			MakeShared<FOnetBoardSnapshot, ESPMode::ThreadSafe>();
+		Snapshot->Version = BoardVersion;
+		Snapshot->BoardHash = BoardHash;
+		Snapshot->Width = Width;
+		Snapshot->Height = Height;
+		Snapshot->PhysicalWidth = PhysicalWidth;
+		Snapshot->PhysicalHeight = PhysicalHeight;
+		Snapshot->Tiles = Tiles;
+		Snapshot->RemainingShuffleUses = RemainingShuffleUses;
+		Snapshot->MaxShuffleUses = Rules.MaxShuffleUses;
+		CachedSnapshot = Snapshot;
+	}
+
+	return CachedSnapshot.ToSharedRef();
+}
+
+/**
+ * Empty a single logical cell and update derived lookup structures incrementally.
+ *
+ * @param Logical - Logical coordinates of the tile to clear.
+ */
+void FOnetBoardCore::ClearTile(const FIntPoint& Logical)
+{
+	const FIntPoint Phys = LogicalToPhysical(Logical);
+	const int32 PhysIndex = PhysicalToIndex(Phys.X, Phys.Y);
+	const int32 TypeId = Tiles.GetType(Phys.X, Phys.Y);
+	if (TypeId == INDEX_NONE)
+	{
+		return;
+	}
+
+	Tiles.SetType(Phys.X, Phys.Y, INDEX_NONE);
+	BoardHash ^= FOnetZobrist::GetTileKey(Logical.X, Logical.Y, TypeId);
+	++BoardVersion;
+	FreeRuns.MarkEmpty(Phys.X, Phys.Y);
+	EmptyRegions.MarkEmpty(Phys.X, Phys.Y);
+	TypeBuckets.Remove(PhysIndex);
+	RemoveMovesInvolving(Logical);
+
+	// Summary counters; the bounding box only shrinks when an edge row/column runs out of tiles.
+	--RemainingTileCount;
+	--RowTileCounts[Logical.Y];
+	--ColumnTileCounts[Logical.X];
+
+	if (RemainingTileCount == 0)
+	{
+		LiveBoundsMin = FIntPoint(-1, -1);
+		LiveBoundsMax = FIntPoint(-1, -1);
+		return;
+	}
+
+	while (RowTileCounts[LiveBoundsMin.Y] == 0)
+	{
+		++LiveBoundsMin.Y;
+	}
+	while (RowTileCounts[LiveBoundsMax.Y] == 0)
+	{
+		--LiveBoundsMax.Y;
+	}
+	while (ColumnTileCounts[LiveBoundsMin.X] == 0)
+	{
+		++LiveBoundsMin.X;
+	}
+	while (ColumnTileCounts[LiveBoundsMax.X] == 0)
+	{
+		--LiveBoundsMax.X;
+	}
+}
+
+/**
+ * Recompute the available-moves index from scratch.
+ * Only needed when the whole board is repopulated (initialize/shuffle).
+ */
+void FOnetBoardCore::RebuildMoveIndex()
+{
+	AvailableMoveKeys.Reset();
+	EnumerateAllMoves(AvailableMoves);
+
+	for (const FOnetTilePair& Move : AvailableMoves)
+	{
+		AvailableMoveKeys.Add(MakeMoveKey(Move.First, Move.Second));
+	}
+}
+
+/**
+ * Re-evaluate the pairs that a removal can have unblocked.
+ * Removing tiles only frees cells, so existing moves stay valid (minus the ones using the removed
+ * tiles, see RemoveMovesInvolving). A corridor that gained a link runs through a freed cell, and
+ * both halves of it (freed cell to either tile) take at most 2 turns, so both tiles of every new
+ * pair are in the reach of a freed cell. Only those tiles are searched for partners; the rest of
+ * the board is never visited, whatever its size.
+ *
+ * @param FreedCells - Logical coordinates of the cells that just became empty.
+ */
+void FOnetBoardCore::RefreshMoveIndex(const TConstArrayView<FIntPoint> FreedCells)
+{
+	if (FreedCells.Num() == 0 || IsCleared())
+	{
+		return;
+	}
+
+	const FIntPoint BoundsMin = LiveBoundsMin + FIntPoint(1, 1);
+	const FIntPoint BoundsMax = LiveBoundsMax + FIntPoint(1, 1);
+
+	TArray<int32> Sources;
+	for (const FIntPoint& Freed : FreedCells)
+	{
+		FreeRuns.ForEachReachableCell(BoundsMin, BoundsMax, LogicalToPhysical(Freed),
+		                              [this, &Sources](const int32 PhysX, const int32 PhysY)
+		                              {
+			                              Sources.Add(PhysicalToIndex(PhysX, PhysY));
+		                              });
+	}
+
+	Sources.Sort();
+	auto GetType = [this](const int32 PhysX, const int32 PhysY) { return Tiles.GetType(PhysX, PhysY); };
+
+	// Both tiles of a new pair are sources, so partners with a higher index are enough.
+	TArray<int32, TInlineAllocator<32>> Partners;
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		const int32 Cell = Sources[i];
+		if (i > 0 && Cell == Sources[i - 1])
+		{
+			continue;
+		}
+
+		FreeRuns.CollectLinkedPartners(BoundsMin, BoundsMax, PhysicalIndexToPoint(Cell), Tiles.GetType(Cell), GetType,
+		                               Partners);
+		for (const int32 Partner : Partners)
+		{
+			const FIntPoint A = PhysicalIndexToLogical(Cell);
+			const FIntPoint B = PhysicalIndexToLogical(Partner);
+			if (!AvailableMoveKeys.Contains(MakeMoveKey(A, B)))
+			{
+				AddAvailableMove(A, B);
+			}
+		}
+	}
+}
+
+void FOnetBoardCore::AddAvailableMove(const FIntPoint& A, const FIntPoint& B)
+{
+	AvailableMoveKeys.Add(MakeMoveKey(A, B));
+	AvailableMoves.Add(FOnetTilePair(A, B));
+}
+
+/**
+ * Drop every indexed move that uses the tile at Logical.
+ */
+void FOnetBoardCore::RemoveMovesInvolving(const FIntPoint& Logical)
+{
+	for (int32 i = AvailableMoves.Num() - 1; i >= 0; --i)
+	{
+		const FOnetTilePair& Move = AvailableMoves[i];
+		if (Move.First == Logical || Move.Second == Logical)
+		{
+			AvailableMoveKeys.Remove(MakeMoveKey(Move.First, Move.Second));
+			AvailableMoves.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+}
+
+uint64 FOnetBoardCore::MakeMoveKey(const FIntPoint& A, const FIntPoint& B) const
+{
+	const uint32 IndexA = static_cast<uint32>(LogicalToPhysicalIndex(A.X, A.Y));
+	const uint32 IndexB = static_cast<uint32>(LogicalToPhysicalIndex(B.X, B.Y));
+	return (static_cast<uint64>(FMath::Min(IndexA, IndexB)) << 32) | FMath::Max(IndexA, IndexB);
+}
+
+/**
+ * Refill an emptied board so that at least ShuffleGuaranteedMoves pairs are linkable.
+ *
+ * Two cells on the same edge of the logical region always link through the padded ring
+ * (out, along the ring, back in), whatever else is on the board. Same-type pairs are placed
+ * on such edge slots first; the remaining tiles then fill the remaining shuffled slots.
+ * Cost is linear in the number of cells, so a shuffle never needs a retry (and a second charge).
+ *
+ * @param ShuffledTypes - Types of the remaining tiles, already shuffled.
+ * @param ShuffledSlots - Every logical cell, already shuffled.
+ */
+void FOnetBoardCore::PopulateGuaranteedShuffle(const TConstArrayView<int32> ShuffledTypes,
+                                               const TConstArrayView<FIntPoint> ShuffledSlots)
+{
+	auto PlaceTile = [this](const FIntPoint& Slot, const int32 TypeId)
+	{
+		Tiles.SetType(Slot.X + 1, Slot.Y + 1, TypeId);
+	};
+
+	// Candidate slot pairs: each edge paired up in random order, then all edges mixed.
+	TArray<FOnetTilePair> EdgePairs;
+	EdgePairs.Reserve(Width + Height + 2);
+	TArray<int32> EdgePositions;
+
+	auto AddEdgePairs = [&EdgePairs, &EdgePositions](const FIntPoint& Origin, const FIntPoint& Step, const int32 Length)
+	{
+		EdgePositions.SetNumUninitialized(Length, EAllowShrinking::No);
+		for (int32 i = 0; i < Length; ++i)
+		{
+			EdgePositions[i] = i;
+		}
+		for (int32 i = Length - 1; i > 0; --i)
+		{
+			const int32 SwapIndex = RandomStream.RandRange(0, i);
+			if (i != SwapIndex)
+			{
+				EdgePositions.Swap(i, SwapIndex);
+			}
+		}
+		for (int32 i = 0; i + 1 < Length; i += 2)
+		{
+			EdgePairs.Emplace(Origin + Step * EdgePositions[i], Origin + Step * EdgePositions[i + 1]);
+		}
+	};
+
+	AddEdgePairs(FIntPoint(0, 0), FIntPoint(1, 0), Width);
+	AddEdgePairs(FIntPoint(0, 0), FIntPoint(0, 1), Height);
+	if (Height > 1)
+	{
+		AddEdgePairs(FIntPoint(0, Height - 1), FIntPoint(1, 0), Width);
+	}
+	if (Width > 1)
+	{
+		AddEdgePairs(FIntPoint(Width - 1, 0), FIntPoint(0, 1), Height);
+	}
+
+	for (int32 i = EdgePairs.Num() - 1; i > 0; --i)
+	{
+		const int32 SwapIndex = RandomStream.RandRange(0, i);
+		if (i != SwapIndex)
+		{
+			EdgePairs.Swap(i, SwapIndex);
+		}
+	}
+
+	// Tiles left per type, and how many of them the guaranteed pairs have already taken.
+	int32 NumTypeIds = 0;
+	for (const int32 TypeId : ShuffledTypes)
+	{
+		NumTypeIds = FMath::Max(NumTypeIds, TypeId + 1);
+	}
+
+	TArray<int32> TypeCounts;
+	TArray<int32> TakenCounts;
+	TypeCounts.SetNumZeroed(NumTypeIds);
+	TakenCounts.SetNumZeroed(NumTypeIds);
+	for (const int32 TypeId : ShuffledTypes)
+	{
+		++TypeCounts[TypeId];
+	}
+
+	// Used logical slots, Index = Y * Width + X.
+	TBitArray<> UsedSlots(false, Width * Height);
+
+	// Walking the shuffled types picks the guaranteed pair types at random (weighted by count).
+	const int32 TargetPairs = FMath::Min(Rules.ShuffleGuaranteedMoves, ShuffledTypes.Num() / 2);
+	int32 NumGuaranteed = 0;
+	int32 NextEdgePair = 0;
+
+	for (int32 i = 0; i < ShuffledTypes.Num() && NumGuaranteed < TargetPairs; ++i)
+	{
+		const int32 TypeId = ShuffledTypes[i];
+		if (TypeCounts[TypeId] - TakenCounts[TypeId] < 2)
+		{
+			continue;
+		}
+
+		// Corners belong to two edges, so skip pairs that reuse a slot.
+		while (NextEdgePair < EdgePairs.Num() &&
+			(UsedSlots[EdgePairs[NextEdgePair].First.Y * Width + EdgePairs[NextEdgePair].First.X] ||
+				UsedSlots[EdgePairs[NextEdgePair].Second.Y * Width + EdgePairs[NextEdgePair].Second.X]))
+		{
+			++NextEdgePair;
+		}
+
+		if (NextEdgePair >= EdgePairs.Num())
+		{
+			break;
+		}
+
+		const FOnetTilePair& Slots = EdgePairs[NextEdgePair++];
+		PlaceTile(Slots.First, TypeId);
+		PlaceTile(Slots.Second, TypeId);
+		UsedSlots[Slots.First.Y * Width + Slots.First.X] = true;
+		UsedSlots[Slots.Second.Y * Width + Slots.Second.X] = true;
+		TakenCounts[TypeId] += 2;
+		++NumGuaranteed;
+	}
+
+	if (NumGuaranteed < TargetPairs)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Guaranteed shuffle seeded %d of %d requested pairs."), NumGuaranteed,
+		       TargetPairs);
+	}
+
+	// Fill the rest in shuffled order, skipping the tiles and slots the guaranteed pairs took.
+	int32 NextSlot = 0;
+	for (const int32 TypeId : ShuffledTypes)
+	{
+		if (TakenCounts[TypeId] > 0)
+		{
+			--TakenCounts[TypeId];
+			continue;
+		}
+
+		while (UsedSlots[ShuffledSlots[NextSlot].Y * Width + ShuffledSlots[NextSlot].X])
+		{
+			++NextSlot;
+		}
+
+		PlaceTile(ShuffledSlots[NextSlot++], TypeId);
+	}
+}
+
+/**
+ * Generate ShuffleCandidateCount slot permutations, score them (on worker threads on large boards) and keep the best.
+ * Candidate 0 is the incoming order; the rest are reshuffled with one stream each, seeded here from
+ * RandomStream so that worker threads never share a generator.
+ *
+ * @param ShuffledTypes - Types of the remaining tiles, in placement order.
+ * @param InOutSlots - Shuffled logical slots; replaced by the winning permutation.
+ */
+void FOnetBoardCore::SelectBestShuffleCandidate(const TConstArrayView<int32> ShuffledTypes,
+                                                TArray<FIntPoint>& InOutSlots)
+{
+	const int32 NumCandidates = FMath::Max(1, Rules.ShuffleCandidateCount);
+	if (NumCandidates == 1 || ShuffledTypes.Num() < 2)
+	{
+		return;
+	}
+
+	TArray<int32> Seeds;
+	Seeds.SetNumUninitialized(NumCandidates);
+	for (int32& Seed : Seeds)
+	{
+		Seed = static_cast<int32>(RandomStream.GetUnsignedInt());
+	}
+
+	TArray<TArray<FIntPoint>> Candidates;
+	TArray<int32> Scores;
+	Candidates.SetNum(NumCandidates);
+	Scores.SetNumZeroed(NumCandidates);
+
+	// Same size gate as ForEachTileType; small boards score faster than the task graph dispatches.
+	const bool bParallel = Rules.ParallelSearchMinCells > 0 && Width * Height >= Rules.ParallelSearchMinCells;
+	ParallelFor(NumCandidates, [this, ShuffledTypes, &InOutSlots, &Seeds, &Candidates, &Scores](const int32 Candidate)
+	{
+		TArray<FIntPoint>& Slots = Candidates[Candidate];
+		Slots = InOutSlots;
+
+		if (Candidate > 0)
+		{
+			FRandomStream Stream(Seeds[Candidate]);
+			for (int32 i = Slots.Num() - 1; i > 0; --i)
+			{
+				const int32 SwapIndex = Stream.RandRange(0, i);
+				if (i != SwapIndex)
+				{
+					Slots.Swap(i, SwapIndex);
+				}
+			}
+		}
+
+		Scores[Candidate] = ScoreShuffleCandidate(ShuffledTypes, Slots);
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	int32 BestCandidate = 0;
+	for (int32 Candidate = 1; Candidate < NumCandidates; ++Candidate)
+	{
+		if (Scores[Candidate] > Scores[BestCandidate])
+		{
+			BestCandidate = Candidate;
+		}
+	}
+
+	InOutSlots = MoveTemp(Candidates[BestCandidate]);
+}
+
+/**
+ * Count the linkable pairs of a candidate layout on private copies of the lookup structures.
+ * Touches no member state besides the board dimensions, so candidates can be scored concurrently.
+ *
+ * @param ShuffledTypes - Types of the remaining tiles, in placement order.
+ * @param Slots - Logical slot of every entry in ShuffledTypes (extra slots stay empty).
+ */
+int32 FOnetBoardCore::ScoreShuffleCandidate(const TConstArrayView<int32> ShuffledTypes,
+                                            const TConstArrayView<FIntPoint> Slots) const
+{
+	FOnetOccupancyMask CandidateOccupancy;
+	FOnetFreeRunTable CandidateRuns;
+	FOnetTypeBuckets CandidateBuckets;
+
+	CandidateOccupancy.Reset(PhysicalWidth, PhysicalHeight);
+
+	TArray<int32> CellTypes;
+	CellTypes.Init(INDEX_NONE, PhysicalWidth * PhysicalHeight);
+
+	FIntPoint BoundsMin(MAX_int32, MAX_int32);
+	FIntPoint BoundsMax(-1, -1);
+
+	const int32 NumToPlace = FMath::Min(ShuffledTypes.Num(), Slots.Num());
+	for (int32 i = 0; i < NumToPlace; ++i)
+	{
+		const FIntPoint& Slot = Slots[i];
+		CandidateOccupancy.SetOccupied(Slot.X + 1, Slot.Y + 1, true);
+		CellTypes[LogicalToPhysicalIndex(Slot.X, Slot.Y)] = ShuffledTypes[i];
+		BoundsMin = BoundsMin.ComponentMin(Slot + FIntPoint(1, 1));
+		BoundsMax = BoundsMax.ComponentMax(Slot + FIntPoint(1, 1));
+	}
+
+	CandidateRuns.Rebuild(CandidateOccupancy);
+	CandidateBuckets.Rebuild(CellTypes);
+
+	auto GetType = [this, &CellTypes](const int32 PhysX, const int32 PhysY)
+	{
+		return CellTypes[PhysicalToIndex(PhysX, PhysY)];
+	};
+
+	int32 NumMoves = 0;
+	TArray<int32, TInlineAllocator<32>> Partners;
+	for (int32 Type = 0; Type < CandidateBuckets.GetNumTypes(); ++Type)
+	{
+		const TConstArrayView<int32> Cells = CandidateBuckets.GetCells(Type);
+		if (IsLargeBoard() && Cells.Num() >= FOnetFreeRunTable::ReachSearchMinTiles)
+		{
+			// Same reach search as ForEachLinkablePair.
+			for (const int32 Cell : Cells)
+			{
+				CandidateRuns.CollectLinkedPartners(BoundsMin, BoundsMax, PhysicalIndexToPoint(Cell), Type, GetType,
+				                                    Partners);
+				NumMoves += Partners.Num();
+			}
+			continue;
+		}
+
+		for (int32 i = 0; i < Cells.Num(); ++i)
+		{
+			for (int32 j = i + 1; j < Cells.Num(); ++j)
+			{
+				FIntPoint CornerA;
+				FIntPoint CornerB;
+				if (CandidateRuns.FindCorridor(BoundsMin, BoundsMax, PhysicalIndexToPoint(Cells[i]),
+				                               PhysicalIndexToPoint(Cells[j]), CornerA, CornerB))
+				{
+					++NumMoves;
+				}
+			}
+		}
+	}
+
+	return NumMoves;
+}
+
+bool FOnetBoardCore::FindFirstAvailableMatch(FIntPoint& OutTileA, FIntPoint& OutTileB,
+                                             TArray<FIntPoint>& OutPath) const
+{
+	OutTileA = FIntPoint(-1, -1);
+	OutTileB = FIntPoint(-1, -1);
+	OutPath.Empty();
+
+	if (Width <= 0 || Height <= 0 || IsCleared())
+	{
+		return false;
+	}
+
+	// Only same-type pairs can match; the persistent buckets already group them.
+	// Each type records its own first hit; the shared flag cancels every other worker once one is found.
+	std::atomic<bool> bFound(false);
+	TArray<FOnetTilePair> FoundByType;
+	FoundByType.SetNum(TypeBuckets.GetNumTypes());
+
+	ForEachTileType([this, &bFound, &FoundByType](const int32 Type)
+	{
+		if (bFound.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		ForEachLinkablePair(Type, [this, &bFound, &Found = FoundByType[Type]](const int32 CellA, const int32 CellB)
+		{
+			Found = FOnetTilePair(PhysicalIndexToLogical(CellA), PhysicalIndexToLogical(CellB));
+			bFound.store(true, std::memory_order_relaxed);
+			return false;
+		});
+	});
+
+	if (!bFound.load())
+	{
+		return false;
+	}
+
+	// Prefer the lowest type that finished, and only build the path for the pair we return.
+	for (const FOnetTilePair& Found : FoundByType)
+	{
+		if (Found.First.X >= 0)
+		{
+			const FIntPoint PhysA = LogicalToPhysical(Found.First);
+			const FIntPoint PhysB = LogicalToPhysical(Found.Second);
+			FIntPoint CornerA;
+			FIntPoint CornerB;
+			if (FindLinkCorners(PhysA, PhysB, CornerA, CornerB))
+			{
+				OutTileA = Found.First;
+				OutTileB = Found.Second;
+				BuildLinkPath(PhysA, CornerA, CornerB, PhysB, OutPath);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Enumerate every linkable pair on the current board.
+ * Large boards split the work by tile type across worker threads; every type fills its own
+ * list, and the lists are concatenated in type order afterwards, so no locking is needed.
+ *
+ * @param OutMoves - Receives all linkable pairs (logical coordinates).
+ */
+void FOnetBoardCore::EnumerateAllMoves(TArray<FOnetTilePair>& OutMoves) const
+{
+	OutMoves.Reset();
+	if (IsCleared())
+	{
+		return;
+	}
+
+	TArray<TArray<FOnetTilePair>> MovesByType;
+	MovesByType.SetNum(TypeBuckets.GetNumTypes());
+
+	ForEachTileType([this, &MovesByType](const int32 Type)
+	{
+		ForEachLinkablePair(Type, [this, &Moves = MovesByType[Type]](const int32 CellA, const int32 CellB)
+		{
+			Moves.Add(FOnetTilePair(PhysicalIndexToLogical(CellA), PhysicalIndexToLogical(CellB)));
+			return true;
+		});
+	});
+
+	int32 NumMoves = 0;
+	for (const TArray<FOnetTilePair>& Moves : MovesByType)
+	{
+		NumMoves += Moves.Num();
+	}
+
+	OutMoves.Reserve(NumMoves);
+	for (const TArray<FOnetTilePair>& Moves : MovesByType)
+	{
+		OutMoves.Append(Moves);
+	}
+}
+
+/**
+ * Run Body once per tile type. Boards with at least ParallelSearchMinCells logical cells
+ * spread the types over the task graph; smaller boards stay on the calling thread.
+ * Body must only read board state.
+ */
+void FOnetBoardCore::ForEachTileType(const TFunctionRef<void(int32)> Body) const
+{
+	const bool bParallel = Rules.ParallelSearchMinCells > 0 && Width * Height >= Rules.ParallelSearchMinCells;
+	ParallelFor(TypeBuckets.GetNumTypes(), Body,
+	            bParallel ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+}
+
+/**
+ * Visit the linkable pairs of one tile type.
+ * Small buckets test every pair of the bucket. On large boards, big buckets flood each tile's
+ * reach instead: the pairs tested per tile no longer grow with the bucket, which turns the
+ * quadratic scan of a huge board into a linear one.
+ *
+ * @param Visit - Receives the physical indices of both tiles; return false to stop.
+ */
+void FOnetBoardCore::ForEachLinkablePair(const int32 Type, const TFunctionRef<bool(int32, int32)> Visit) const
+{
+	const TConstArrayView<int32> Cells = TypeBuckets.GetCells(Type);
+
+	if (!IsLargeBoard() || Cells.Num() < FOnetFreeRunTable::ReachSearchMinTiles)
+	{
+		for (int32 i = 0; i < Cells.Num(); ++i)
+		{
+			for (int32 j = i + 1; j < Cells.Num(); ++j)
+			{
+				// Bucketed cells are occupied and share a type, so skip CanLink's validation.
+				FIntPoint CornerA;
+				FIntPoint CornerB;
+				if (FindLinkCorners(PhysicalIndexToPoint(Cells[i]), PhysicalIndexToPoint(Cells[j]), CornerA, CornerB) &&
+					!Visit(Cells[i], Cells[j]))
+				{
+					return;
+				}
+			}
+		}
+		return;
+	}
+
+	auto GetType = [this](const int32 PhysX, const int32 PhysY) { return Tiles.GetType(PhysX, PhysY); };
+
+	TArray<int32, TInlineAllocator<32>> Partners;
+	for (const int32 Cell : Cells)
+	{
+		FreeRuns.CollectLinkedPartners(LiveBoundsMin + FIntPoint(1, 1), LiveBoundsMax + FIntPoint(1, 1),
+		                               PhysicalIndexToPoint(Cell), Type, GetType, Partners);
+		for (const int32 Partner : Partners)
+		{
+			if (!Visit(Cell, Partner))
+			{
+				return;
+			}
+		}
+	}
+}
+
+bool FOnetBoardCore::IsCleared() const
+{
+	return Width <= 0 || Height <= 0 || RemainingTileCount == 0;
+}
+
+int32 FOnetBoardCore::GetRowTileCount(const int32 Y) const
+{
+	return RowTileCounts.IsValidIndex(Y) ? RowTileCounts[Y] : 0;
+}
+
+int32 FOnetBoardCore::GetColumnTileCount(const int32 X) const
+{
+	return ColumnTileCounts.IsValidIndex(X) ? ColumnTileCounts[X] : 0;
+}
+
+bool FOnetBoardCore::GetLiveBounds(FIntPoint& OutMin, FIntPoint& OutMax) const
+{
+	OutMin = LiveBoundsMin;
+	OutMax = LiveBoundsMax;
+	return RemainingTileCount > 0;
+}
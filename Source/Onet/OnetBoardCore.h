@@ -0,0 +1,285 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardOccupancy.h"
+#include "OnetBoardSnapshot.h"
+#include "OnetBoardTypes.h"
+#include "OnetTileStorage.h"
+#include "OnetTypeBuckets.h"
+
+/**
+ * Rules a board core plays by. UOnetBoardComponent fills them from its editor properties.
+ */
+struct FOnetBoardRules
+{
+	// Layout strategy used by Initialize.
+	EOnetBoardGeneration BoardGeneration = EOnetBoardGeneration::RandomBag;
+
+	// Redistribution strategy used by every shuffle.
+	EOnetShuffleMode ShuffleMode = EOnetShuffleMode::Random;
+
+	// Linkable pairs a GuaranteedMoves shuffle seeds (clamped to what the board edges can hold).
+	int32 ShuffleGuaranteedMoves = 1;
+
+	// Random permutations a BestOfCandidates shuffle generates and scores.
+	int32 ShuffleCandidateCount = 8;
+
+	// Boards with at least this many logical cells run move searches and shuffle candidate scoring
+	// on worker threads (0 = never).
+	int32 ParallelSearchMinCells = 4096;
+
+	// Shuffle charges per game.
+	int32 MaxShuffleUses = 3;
+
+	// Boards with at least this many logical cells use chunked tile storage and reach-based move
+	// searches, and keep an odd cell count instead of losing a row (0 = never).
+	int32 LargeBoardMinCells = 262144;
+
+	// Seed of the stream behind generation and shuffles; the same seed and moves replay the same
+	// boards (0 = pick a new seed on every Initialize).
+	int32 RandomSeed = 0;
+};
+
+/**
+ * Onet board state and rules, independent of the engine's object model.
+ *
+ * Owns the tiles and every derived lookup structure (free runs, empty regions, type
+ * buckets, move index, hash, version) and implements generation, linking, removal and shuffles.
+ * It allocates no UObjects, needs no world and broadcasts nothing, so simulations, solvers and
+ * tests can run thousands of boards side by side. UOnetBoardComponent wraps one core and adds
+ * selection, timing, background work and events on top.
+ *
+ * Not thread-safe: use one core per thread, or hand other threads a snapshot (GetSnapshot).
+ * Coordinates are logical unless stated otherwise.
+ */
+class ONET_API FOnetBoardCore
+{
+public:
+	FOnetBoardRules Rules;
+
+	// Lay out a new board with the current rules and refill the shuffle charges.
+	// Odd cell counts lose a row (large boards leave one cell empty instead). Returns the number of tile types used.
+	int32 Initialize(int32 InWidth, int32 InHeight, int32 InNumTileTypes);
+
+	bool IsInitialized() const { return Tiles.Num() > 0; }
+
+	// Seed the current board was generated with (Rules.RandomSeed, or the one picked for it).
+	int32 GetRandomSeed() const { return RandomStream.GetInitialSeed(); }
+
+	// True if the board is at or above Rules.LargeBoardMinCells logical cells.
+	bool IsLargeBoard() const
+	{
+		return Rules.LargeBoardMinCells > 0 && Width * Height >= Rules.LargeBoardMinCells;
+	}
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+	// Every tile on the board has a type id below this (max type id + 1).
+	int32 GetNumTileTypes() const { return TypeBuckets.GetNumTypes(); }
+
+	bool IsInBounds(const int32 X, const int32 Y) const
+	{
+		return X >= 0 && X < Width && Y >= 0 && Y < Height;
+	}
+
+	// Read a tile at (X, Y). Returns false if out of bounds.
+	bool GetTile(int32 X, int32 Y, FOnetTile& OutTile) const;
+
+	// Tile type at (X, Y), INDEX_NONE if the cell is empty; X and Y must be in bounds.
+	int32 GetTileType(const int32 X, const int32 Y) const
+	{
+		return Tiles.GetType(LogicalToPhysicalIndex(X, Y));
+	}
+
+	// Dense index of a cell (used by ComputeReachableCells), and back.
+	int32 GetCellIndex(const FIntPoint& Logical) const { return LogicalToPhysicalIndex(Logical.X, Logical.Y); }
+	FIntPoint GetCellCoordinates(const int32 CellIndex) const { return PhysicalIndexToLogical(CellIndex); }
+	int32 GetTileTypeByIndex(const int32 CellIndex) const { return Tiles.GetType(CellIndex); }
+
+	// Check if two same-type tiles can be linked with at most 2 turns, and build the path if so.
+	bool CanLink(int32 X1, int32 Y1, int32 X2, int32 Y2, TArray<FIntPoint>& OutPath) const;
+
+	// Check many candidate pairs in one pass. Bit i of OutLinked is set if Pairs[i] can be linked;
+	// paths are only built when OutPaths is given. Returns the number of linkable pairs.
+	int32 CanLinkBatch(TConstArrayView<FOnetTilePair> Pairs, TBitArray<>& OutLinked,
+	                   TArray<TArray<FIntPoint>>* OutPaths = nullptr) const;
+
+	// Shortest link between two occupied cells, without checking their types.
+	bool FindLinkPath(const FIntPoint& A, const FIntPoint& B, TArray<FIntPoint>& OutPath) const;
+
+	// Mark every occupied cell the tile at Logical can reach within two turns (one bit per cell index).
+	void ComputeReachableCells(const FIntPoint& Logical, TBitArray<>& OutReach) const;
+
+	// Remove a matched pair and update every derived structure incrementally.
+	void RemovePair(const FIntPoint& A, const FIntPoint& B);
+
+	// Redistribute the remaining tiles with the current rules. Consumes a charge; false if none is left.
+	// OutChangedCells (optional) receives every cell whose tile differs afterwards.
+	bool Shuffle(TArray<FIntPoint>* OutChangedCells = nullptr);
+
+	// Return true if all logical tiles are empty.
+	bool IsCleared() const;
+
+	// Tiles are left, but no pair among them links.
+	bool IsDeadlocked() const { return !IsCleared() && AvailableMoves.Num() == 0; }
+
+	// Shuffle until a move exists. Returns false if the charges ran out first.
+	bool ResolveDeadlock();
+
+	// Currently linkable pairs, kept up to date across removals and shuffles.
+	int32 GetAvailableMoveCount() const { return AvailableMoves.Num(); }
+	const TArray<FOnetTilePair>& GetAvailableMoves() const { return AvailableMoves; }
+
+	// Enumerate every linkable pair from scratch (parallel on large boards).
+	void EnumerateAllMoves(TArray<FOnetTilePair>& OutMoves) const;
+
+	// Scan the board from scratch for any valid match (independent of the move index).
+	bool FindFirstAvailableMatch(FIntPoint& OutTileA, FIntPoint& OutTileB, TArray<FIntPoint>& OutPath) const;
+
+	// Board summary.
+	int32 GetRemainingTileCount() const { return RemainingTileCount; }
+	int32 GetRowTileCount(int32 Y) const;
+	int32 GetColumnTileCount(int32 X) const;
+	bool GetLiveBounds(FIntPoint& OutMin, FIntPoint& OutMax) const;
+
+	int32 GetRemainingShuffleUses() const { return RemainingShuffleUses; }
+
+	// Zobrist hash kept current incrementally, and the same hash computed from scratch.
+	uint64 GetBoardHash() const { return BoardHash; }
+	uint64 ComputeBoardHash() const;
+
+	// Monotonic counter bumped by every change to the board (tiles or shuffle charges).
+	uint64 GetBoardVersion() const { return BoardVersion; }
+
+	// Immutable copy of the board at the current version; repeated calls share one copy until the board changes.
+	FOnetBoardSnapshotRef GetSnapshot() const;
+
+	// Whether results computed from Snapshot still describe the board.
+	bool IsSnapshotCurrent(const FOnetBoardSnapshot& Snapshot) const
+	{
+		return Snapshot.Version == BoardVersion;
+	}
+
+private:
+	// Logical dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Physical dimensions (includes padding)
+	// PhysicalWidth = Width + 2, PhysicalHeight = Height + 2
+	// The outer ring is always empty, allowing paths to go around the board edges.
+	int32 PhysicalWidth = 0;
+	int32 PhysicalHeight = 0;
+
+	// Packed tile types in a 1D array for simplicity and better cache-friendliness.
+	// Index = PhysY * PhysicalWidth + PhysX (using physical coordinates)
+	FOnetTileStorage Tiles;
+
+	// Per-cell empty-run extents (physical coordinates); makes every straight-segment test O(1).
+	FOnetFreeRunTable FreeRuns;
+
+	// Connected regions of empty cells (padding included); rejects unconnectable pairs early.
+	FOnetEmptyRegions EmptyRegions;
+
+	// Occupied cells grouped by tile type (physical indices); patched on removal.
+	FOnetTypeBuckets TypeBuckets;
+
+	// Zobrist hash of the occupied tiles; XOR-updated on every placement/removal.
+	uint64 BoardHash = 0;
+
+	// Board version (see GetBoardVersion) and the snapshot shared for it, created on demand.
+	uint64 BoardVersion = 0;
+	mutable TSharedPtr<const FOnetBoardSnapshot, ESPMode::ThreadSafe> CachedSnapshot;
+
+	// Board summary, kept current incrementally (logical coordinates).
+	int32 RemainingTileCount = 0;
+	TArray<int32> RowTileCounts;
+	TArray<int32> ColumnTileCounts;
+	FIntPoint LiveBoundsMin = FIntPoint(-1, -1);
+	FIntPoint LiveBoundsMax = FIntPoint(-1, -1);
+
+	// Index of currently linkable pairs (logical coordinates), plus their keys for O(1) lookups.
+	// Patched in RemovePair, rebuilt whenever the board is repopulated.
+	TArray<FOnetTilePair> AvailableMoves;
+	TSet<uint64> AvailableMoveKeys;
+
+	// Remaining shuffle charges.
+	int32 RemainingShuffleUses = 0;
+
+	// Source of every random choice (layout, shuffles, candidate seeds); seeded by Initialize.
+	FRandomStream RandomStream;
+
+	// Convert logical coordinate to physical coordinate (add padding offset)
+	FIntPoint LogicalToPhysical(const FIntPoint& Logical) const
+	{
+		return FIntPoint(Logical.X + 1, Logical.Y + 1);
+	}
+
+	// Convert logical coordinates to physical index in Tiles array
+	int32 LogicalToPhysicalIndex(const int32 X, const int32 Y) const
+	{
+		return (Y + 1) * PhysicalWidth + (X + 1);
+	}
+
+	// Convert physical coordinates to index in Tiles array
+	int32 PhysicalToIndex(const int32 PhysX, const int32 PhysY) const
+	{
+		return PhysY * PhysicalWidth + PhysX;
+	}
+
+	// Convert an index in Tiles array back to physical coordinates
+	FIntPoint PhysicalIndexToPoint(const int32 PhysIndex) const
+	{
+		return FIntPoint(PhysIndex % PhysicalWidth, PhysIndex / PhysicalWidth);
+	}
+
+	// Convert an index in Tiles array to logical coordinates (remove padding offset)
+	FIntPoint PhysicalIndexToLogical(const int32 PhysIndex) const
+	{
+		return FIntPoint(PhysIndex % PhysicalWidth - 1, PhysIndex / PhysicalWidth - 1);
+	}
+
+	// Corridor-scan link engine (physical coordinates, no allocation).
+	bool FindLinkCorners(const FIntPoint& PhysStart, const FIntPoint& PhysEnd,
+	                     FIntPoint& OutCornerA, FIntPoint& OutCornerB) const;
+
+	// Expand corridor corners into the per-cell logical path broadcast to the UI.
+	static void BuildLinkPath(const FIntPoint& PhysStart, const FIntPoint& CornerA, const FIntPoint& CornerB,
+	                          const FIntPoint& PhysEnd, TArray<FIntPoint>& OutPath);
+
+	// Fill the logical region with PairTypes (one entry per pair) so that it can be cleared completely.
+	void PopulateSolvableLayout(TConstArrayView<int32> PairTypes);
+
+	// Rebuild derived lookup structures (free runs, empty regions, ...) from Tiles.
+	void RebuildBoardCaches();
+
+	// Empty one logical cell and update derived lookup structures incrementally.
+	void ClearTile(const FIntPoint& Logical);
+
+	// Available-moves index maintenance.
+	void RebuildMoveIndex();
+	void RefreshMoveIndex(TConstArrayView<FIntPoint> FreedCells);
+	void AddAvailableMove(const FIntPoint& A, const FIntPoint& B);
+	void RemoveMovesInvolving(const FIntPoint& Logical);
+
+	// Run Body for every tile type, in parallel on large boards. Body must only read board state.
+	void ForEachTileType(TFunctionRef<void(int32)> Body) const;
+
+	// Call Visit(CellA, CellB) (physical indices) for every linkable pair of Type until it returns false.
+	void ForEachLinkablePair(int32 Type, TFunctionRef<bool(int32, int32)> Visit) const;
+
+	// Order-independent key of a pair (physical indices packed into 64 bits).
+	uint64 MakeMoveKey(const FIntPoint& A, const FIntPoint& B) const;
+
+	// Refill the emptied board from shuffled types/slots, seeding ShuffleGuaranteedMoves linkable pairs.
+	void PopulateGuaranteedShuffle(TConstArrayView<int32> ShuffledTypes, TConstArrayView<FIntPoint> ShuffledSlots);
+
+	// Reorder InOutSlots to the best scoring of ShuffleCandidateCount random permutations.
+	void SelectBestShuffleCandidate(TConstArrayView<int32> ShuffledTypes, TArray<FIntPoint>& InOutSlots);
+
+	// Number of linkable pairs when ShuffledTypes[i] is placed on Slots[i]; reads nothing but the dimensions.
+	int32 ScoreShuffleCandidate(TConstArrayView<int32> ShuffledTypes, TConstArrayView<FIntPoint> Slots) const;
+};
@@ -0,0 +1,20 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardHash.h"
+
+/**
+ * Pack the tile into 64 bits and run it through the SplitMix64 finalizer.
+ * The packing is injective and the finalizer is a bijection, so distinct tiles get distinct keys.
+ */
+uint64 FOnetZobrist::GetTileKey(const int32 X, const int32 Y, const int32 TileTypeId)
+{
+	uint64 Key = (static_cast<uint64>(static_cast<uint16>(X)) << 48)
+		| (static_cast<uint64>(static_cast<uint16>(Y)) << 32)
+		| static_cast<uint32>(TileTypeId);
+
+	Key += 0x9E3779B97F4A7C15ull;
+	Key = (Key ^ (Key >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Key = (Key ^ (Key >> 27)) * 0x94D049BB133111EBull;
+	return Key ^ (Key >> 31);
+}
@@ -0,0 +1,19 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Zobrist keys for board fingerprints.
+ *
+ * A board hash is the XOR of the keys of its occupied cells, so placing or removing a tile is a
+ * single XOR. Keys are derived from (logical X, logical Y, tile type) by a fixed mixing function
+ * instead of a random table: no memory per cell/type, and the same position hashes to the same
+ * value on every machine and in every session (replays, desync checks, offline level packs).
+ */
+struct ONET_API FOnetZobrist
+{
+	// Key of a tile of type TileTypeId at logical (X, Y). Coordinates must fit in 16 bits.
+	static uint64 GetTileKey(int32 X, int32 Y, int32 TileTypeId);
+};
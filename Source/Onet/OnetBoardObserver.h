@@ -0,0 +1,36 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardTypes.h"
+
+/**
+ * C++ listener of a UOnetBoardComponent (bots, telemetry, replication, ...).
+ *
+ * Receives the same events as the Blueprint delegates of the component, as plain virtual calls
+ * with array views instead of reflected parameters. Override only what you need; everything
+ * defaults to a no-op. The component does not own its observers: call RemoveObserver before an
+ * observer is destroyed. That is safe from inside a notification too; the removed observer gets
+ * no further calls.
+ */
+class IOnetBoardObserver
+{
+public:
+	virtual ~IOnetBoardObserver() = default;
+
+	virtual void OnBoardChanged() {}
+	virtual void OnCellsChanged(EOnetCellChangeKind Kind, TConstArrayView<FIntPoint> Cells) {}
+	virtual void OnSelectionChanged(bool bHasFirstSelection, const FIntPoint& FirstSelection) {}
+	virtual void OnSelectionPartnersChanged(TConstArrayView<FIntPoint> Partners) {}
+	virtual void OnMatchSuccessful(TConstArrayView<FIntPoint> Path) {}
+	virtual void OnMatchFailed() {}
+	virtual void OnShufflePerformed(int32 RemainingUses, bool bAutoTriggered) {}
+	virtual void OnHintUpdated(bool bHasHint, const FIntPoint& First, const FIntPoint& Second) {}
+	virtual void OnWildStateChanged(bool bWildReady) {}
+	virtual void OnBoardCleared() {}
+	virtual void OnNoMovesRemain() {}
+	virtual void OnSolveProgress(int64 NodesExpanded, float NodesPerSecond) {}
+	virtual void OnSolveFinished(EOnetSolveOutcome Outcome, TConstArrayView<FOnetTilePair> Moves,
+	                             int64 NodesExpanded, float NodesPerSecond) {}
+};
@@ -0,0 +1,537 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardOccupancy.h"
+
+/**
+ * Resize the mask and mark every cell empty.
+ *
+ * @param InWidth - Physical width (padding included).
+ * @param InHeight - Physical height (padding included).
+ */
+void FOnetOccupancyMask::Reset(const int32 InWidth, const int32 InHeight)
+{
+	Width = FMath::Max(0, InWidth);
+	Height = FMath::Max(0, InHeight);
+	RowWords = FMath::DivideAndRoundUp(Width, 64);
+
+	Rows.SetNumUninitialized(Height * RowWords);
+	FMemory::Memzero(Rows.GetData(), Rows.Num() * sizeof(uint64));
+}
+
+void FOnetOccupancyMask::SetOccupied(const int32 X, const int32 Y, const bool bOccupied)
+{
+	const uint64 RowBit = 1ull << (X & 63);
+	uint64& RowWord = Rows[Y * RowWords + (X >> 6)];
+
+	if (bOccupied)
+	{
+		RowWord |= RowBit;
+	}
+	else
+	{
+		RowWord &= ~RowBit;
+	}
+}
+
+/**
+ * Rebuild every run from the occupancy bits with two sweeps per axis.
+ *
+ * @param Occupancy - Mask with the same physical dimensions as the board.
+ */
+void FOnetFreeRunTable::Rebuild(const FOnetOccupancyMask& Occupancy)
+{
+	Width = Occupancy.GetWidth();
+	Height = Occupancy.GetHeight();
+	Runs.SetNumUninitialized(Width * Height);
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		uint16 Run = 0;
+		for (int32 X = 0; X < Width; ++X)
+		{
+			Run = Occupancy.IsOccupied(X, Y) ? 0 : static_cast<uint16>(Run + 1);
+			Runs[Y * Width + X].Left = Run;
+		}
+
+		Run = 0;
+		for (int32 X = Width - 1; X >= 0; --X)
+		{
+			Run = Occupancy.IsOccupied(X, Y) ? 0 : static_cast<uint16>(Run + 1);
+			Runs[Y * Width + X].Right = Run;
+		}
+	}
+
+	for (int32 X = 0; X < Width; ++X)
+	{
+		uint16 Run = 0;
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			Run = Occupancy.IsOccupied(X, Y) ? 0 : static_cast<uint16>(Run + 1);
+			Runs[Y * Width + X].Up = Run;
+		}
+
+		Run = 0;
+		for (int32 Y = Height - 1; Y >= 0; --Y)
+		{
+			Run = Occupancy.IsOccupied(X, Y) ? 0 : static_cast<uint16>(Run + 1);
+			Runs[Y * Width + X].Down = Run;
+		}
+	}
+}
+
+/**
+ * Mark (X, Y) empty. The freed cell joins the runs on either side of it, so only the empty cells
+ * directly left/right/above/below it (up to the next occupied cell) need new extents.
+ */
+void FOnetFreeRunTable::MarkEmpty(const int32 X, const int32 Y)
+{
+	if (IsEmpty(X, Y))
+	{
+		return;
+	}
+
+	FCellRuns& Cell = Runs[Y * Width + X];
+	Cell.Left = X > 0 ? static_cast<uint16>(Runs[Y * Width + X - 1].Left + 1) : 1;
+	Cell.Right = X + 1 < Width ? static_cast<uint16>(Runs[Y * Width + X + 1].Right + 1) : 1;
+	Cell.Up = Y > 0 ? static_cast<uint16>(Runs[(Y - 1) * Width + X].Up + 1) : 1;
+	Cell.Down = Y + 1 < Height ? static_cast<uint16>(Runs[(Y + 1) * Width + X].Down + 1) : 1;
+
+	// Empty cells to the left now run further right (and vice versa).
+	for (int32 Step = 1; Step < Cell.Left; ++Step)
+	{
+		Runs[Y * Width + X - Step].Right = static_cast<uint16>(Cell.Right + Step);
+	}
+	for (int32 Step = 1; Step < Cell.Right; ++Step)
+	{
+		Runs[Y * Width + X + Step].Left = static_cast<uint16>(Cell.Left + Step);
+	}
+	for (int32 Step = 1; Step < Cell.Up; ++Step)
+	{
+		Runs[(Y - Step) * Width + X].Down = static_cast<uint16>(Cell.Down + Step);
+	}
+	for (int32 Step = 1; Step < Cell.Down; ++Step)
+	{
+		Runs[(Y + Step) * Width + X].Up = static_cast<uint16>(Cell.Up + Step);
+	}
+}
+
+int32 FOnetFreeRunTable::CountEmptyRun(const int32 X, const int32 Y, const int32 DirX, const int32 DirY) const
+{
+	const int32 NextX = X + DirX;
+	const int32 NextY = Y + DirY;
+	if (NextX < 0 || NextX >= Width || NextY < 0 || NextY >= Height)
+	{
+		return 0;
+	}
+
+	const FCellRuns& Next = Runs[NextY * Width + NextX];
+	if (DirX > 0)
+	{
+		return Next.Right;
+	}
+	if (DirX < 0)
+	{
+		return Next.Left;
+	}
+	return DirY > 0 ? Next.Down : Next.Up;
+}
+
+/**
+ * Inverse of MarkEmpty: the empty cells next to (X, Y) now stop right before it.
+ */
+void FOnetFreeRunTable::MarkOccupied(const int32 X, const int32 Y)
+{
+	if (!IsEmpty(X, Y))
+	{
+		return;
+	}
+
+	FCellRuns& Cell = Runs[Y * Width + X];
+	for (int32 Step = 1; Step < Cell.Left; ++Step)
+	{
+		Runs[Y * Width + X - Step].Right = static_cast<uint16>(Step);
+	}
+	for (int32 Step = 1; Step < Cell.Right; ++Step)
+	{
+		Runs[Y * Width + X + Step].Left = static_cast<uint16>(Step);
+	}
+	for (int32 Step = 1; Step < Cell.Up; ++Step)
+	{
+		Runs[(Y - Step) * Width + X].Down = static_cast<uint16>(Step);
+	}
+	for (int32 Step = 1; Step < Cell.Down; ++Step)
+	{
+		Runs[(Y + Step) * Width + X].Up = static_cast<uint16>(Step);
+	}
+
+	Cell = FCellRuns();
+}
+
+namespace
+{
+	// Step direction of a straight leg, ranked in the order the old breadth-first CanLink expanded
+	// them: Right, Down, Left, Up.
+	int32 GetStepRank(const FIntPoint& From, const FIntPoint& To)
+	{
+		if (To.X > From.X)
+		{
+			return 0;
+		}
+		if (To.Y > From.Y)
+		{
+			return 1;
+		}
+		return To.X < From.X ? 2 : 3;
+	}
+
+	/**
+	 * Return true if the step sequence of corridor A sorts before that of corridor B (steps ranked by
+	 * GetStepRank). Among equally short links, the breadth-first search returned the smallest one.
+	 *
+	 * @param PathA, PathB - Start, both corners and End of two corridors of the same length.
+	 */
+	bool PrecedesInSearchOrder(const FIntPoint (&PathA)[4], const FIntPoint (&PathB)[4])
+	{
+		// Advance to the next non-empty leg; false once the path is used up.
+		auto NextLeg = [](const FIntPoint (&Path)[4], int32& Leg, int32& StepsLeft)
+		{
+			while (StepsLeft == 0 && Leg < 3)
+			{
+				StepsLeft = FMath::Abs(Path[Leg + 1].X - Path[Leg].X) + FMath::Abs(Path[Leg + 1].Y - Path[Leg].Y);
+				++Leg;
+			}
+			return StepsLeft > 0;
+		};
+
+		int32 LegA = 0;
+		int32 LegB = 0;
+		int32 StepsLeftA = 0;
+		int32 StepsLeftB = 0;
+		while (NextLeg(PathA, LegA, StepsLeftA) && NextLeg(PathB, LegB, StepsLeftB))
+		{
+			const int32 RankA = GetStepRank(PathA[LegA - 1], PathA[LegA]);
+			const int32 RankB = GetStepRank(PathB[LegB - 1], PathB[LegB]);
+			if (RankA != RankB)
+			{
+				return RankA < RankB;
+			}
+
+			const int32 Steps = FMath::Min(StepsLeftA, StepsLeftB);
+			StepsLeftA -= Steps;
+			StepsLeftB -= Steps;
+		}
+		return false;
+	}
+}
+
+/**
+ * Shortest Start -> CornerA -> CornerB -> End corridor through empty cells.
+ *
+ * Returns the path the old breadth-first CanLink found: the shortest corridor, and among equally
+ * short ones the first in its expansion order (see PrecedesInSearchOrder), so match lines keep
+ * their shape.
+ *
+ * @param BoundsMin - Top-left of the occupied cells' bounding box.
+ * @param BoundsMax - Bottom-right of the occupied cells' bounding box.
+ */
+bool FOnetFreeRunTable::FindCorridor(const FIntPoint& BoundsMin, const FIntPoint& BoundsMax, const FIntPoint& Start,
+                                     const FIntPoint& End, FIntPoint& OutCornerA, FIntPoint& OutCornerB) const
+{
+	int32 BestLength = MAX_int32;
+
+	auto Consider = [&](const int32 Length, const FIntPoint& CornerA, const FIntPoint& CornerB)
+	{
+		if (Length < BestLength ||
+			PrecedesInSearchOrder({Start, CornerA, CornerB, End}, {Start, OutCornerA, OutCornerB, End}))
+		{
+			BestLength = Length;
+			OutCornerA = CornerA;
+			OutCornerB = CornerB;
+		}
+	};
+
+	// Horizontal corridors: Start -> (Start.X, Row) -> (End.X, Row) -> End.
+	// Skipped for tiles in the same column; the vertical pass covers the straight line there.
+	if (Start.X != End.X)
+	{
+		// The vertical legs must stay inside the empty runs above/below each endpoint.
+		// Rows outside the live bounding box are empty, so the one right next to it is the shortest detour.
+		const int32 MinRow = FMath::Max3(Start.Y - CountEmptyRun(Start.X, Start.Y, 0, -1),
+		                                 End.Y - CountEmptyRun(End.X, End.Y, 0, -1),
+		                                 BoundsMin.Y - 1);
+		const int32 MaxRow = FMath::Min3(Start.Y + CountEmptyRun(Start.X, Start.Y, 0, 1),
+		                                 End.Y + CountEmptyRun(End.X, End.Y, 0, 1),
+		                                 BoundsMax.Y + 1);
+		const int32 MiddleLength = FMath::Abs(End.X - Start.X);
+
+		const int32 SpanFrom = FMath::Min(Start.X, End.X) + 1;
+		const int32 SpanTo = FMath::Max(Start.X, End.X) - 1;
+
+		for (int32 Row = MinRow; Row <= MaxRow; ++Row)
+		{
+			const int32 Length = FMath::Abs(Row - Start.Y) + MiddleLength + FMath::Abs(End.Y - Row);
+			if (Length > BestLength)
+			{
+				continue;
+			}
+
+			// Corners are either endpoints or covered by the empty runs; only the span between them needs checking.
+			if (IsRowSpanEmpty(Row, SpanFrom, SpanTo))
+			{
+				Consider(Length, FIntPoint(Start.X, Row), FIntPoint(End.X, Row));
+			}
+		}
+	}
+
+	// Vertical corridors: Start -> (Column, Start.Y) -> (Column, End.Y) -> End.
+	if (Start.Y != End.Y)
+	{
+		const int32 MinColumn = FMath::Max3(Start.X - CountEmptyRun(Start.X, Start.Y, -1, 0),
+		                                    End.X - CountEmptyRun(End.X, End.Y, -1, 0),
+		                                    BoundsMin.X - 1);
+		const int32 MaxColumn = FMath::Min3(Start.X + CountEmptyRun(Start.X, Start.Y, 1, 0),
+		                                    End.X + CountEmptyRun(End.X, End.Y, 1, 0),
+		                                    BoundsMax.X + 1);
+		const int32 MiddleLength = FMath::Abs(End.Y - Start.Y);
+
+		const int32 SpanFrom = FMath::Min(Start.Y, End.Y) + 1;
+		const int32 SpanTo = FMath::Max(Start.Y, End.Y) - 1;
+
+		for (int32 Column = MinColumn; Column <= MaxColumn; ++Column)
+		{
+			const int32 Length = FMath::Abs(Column - Start.X) + MiddleLength + FMath::Abs(End.X - Column);
+			if (Length > BestLength)
+			{
+				continue;
+			}
+
+			if (IsColumnSpanEmpty(Column, SpanFrom, SpanTo))
+			{
+				Consider(Length, FIntPoint(Column, Start.Y), FIntPoint(Column, End.Y));
+			}
+		}
+	}
+
+	return BestLength != MAX_int32;
+}
+
+/**
+ * Flood the corridors FindCorridor would scan from Start: for every row (column) Start can reach
+ * vertically (horizontally), follow the free lane and leave it once more; the first occupied cell
+ * hit by any of those rays is reachable. Every ray is an O(1) run lookup.
+ *
+ * Rows and columns outside the bounding box are empty, so lanes are clipped to it: an empty row
+ * next to the box reaches the same tiles as any row further out, and an empty column has nothing
+ * to hit.
+ *
+ * @param BoundsMin - Top-left of the occupied cells' bounding box.
+ * @param BoundsMax - Bottom-right of the occupied cells' bounding box.
+ */
+void FOnetFreeRunTable::ForEachReachableCell(const FIntPoint& BoundsMin, const FIntPoint& BoundsMax,
+                                             const FIntPoint& Start, const TFunctionRef<void(int32, int32)> Visit) const
+{
+	// Visit the first occupied cell hit when walking from (X, Y) in (DirX, DirY).
+	auto VisitHit = [this, &Visit](const int32 X, const int32 Y, const int32 DirX, const int32 DirY)
+	{
+		const int32 Run = CountEmptyRun(X, Y, DirX, DirY);
+		const int32 HitX = X + DirX * (Run + 1);
+		const int32 HitY = Y + DirY * (Run + 1);
+		if (HitX >= 0 && HitX < Width && HitY >= 0 && HitY < Height)
+		{
+			Visit(HitX, HitY);
+		}
+	};
+
+	// Horizontal lanes entered from the start column (the start row itself is the 0-turn lane).
+	const int32 MinRow = FMath::Max(Start.Y - CountEmptyRun(Start.X, Start.Y, 0, -1), BoundsMin.Y - 1);
+	const int32 MaxRow = FMath::Min(Start.Y + CountEmptyRun(Start.X, Start.Y, 0, 1), BoundsMax.Y + 1);
+	for (int32 Row = MinRow; Row <= MaxRow; ++Row)
+	{
+		VisitHit(Start.X, Row, -1, 0);
+		VisitHit(Start.X, Row, 1, 0);
+
+		// Leave the lane vertically (the start column itself is handled by the column pass).
+		const int32 LaneFrom = FMath::Max(Start.X - CountEmptyRun(Start.X, Row, -1, 0), BoundsMin.X);
+		const int32 LaneTo = FMath::Min(Start.X + CountEmptyRun(Start.X, Row, 1, 0), BoundsMax.X);
+		for (int32 Column = LaneFrom; Column <= LaneTo; ++Column)
+		{
+			if (Column != Start.X)
+			{
+				VisitHit(Column, Row, 0, -1);
+				VisitHit(Column, Row, 0, 1);
+			}
+		}
+	}
+
+	// Vertical lanes entered from the start row.
+	const int32 MinColumn = FMath::Max(Start.X - CountEmptyRun(Start.X, Start.Y, -1, 0), BoundsMin.X - 1);
+	const int32 MaxColumn = FMath::Min(Start.X + CountEmptyRun(Start.X, Start.Y, 1, 0), BoundsMax.X + 1);
+	for (int32 Column = MinColumn; Column <= MaxColumn; ++Column)
+	{
+		VisitHit(Column, Start.Y, 0, -1);
+		VisitHit(Column, Start.Y, 0, 1);
+
+		const int32 LaneFrom = FMath::Max(Start.Y - CountEmptyRun(Column, Start.Y, 0, -1), BoundsMin.Y);
+		const int32 LaneTo = FMath::Min(Start.Y + CountEmptyRun(Column, Start.Y, 0, 1), BoundsMax.Y);
+		for (int32 Row = LaneFrom; Row <= LaneTo; ++Row)
+		{
+			if (Row != Start.Y)
+			{
+				VisitHit(Column, Row, -1, 0);
+				VisitHit(Column, Row, 1, 0);
+			}
+		}
+	}
+}
+
+/**
+ * Rebuild regions with one sweep that unions every empty cell with its left/up neighbours.
+ */
+void FOnetEmptyRegions::Rebuild(const FOnetOccupancyMask& Occupancy)
+{
+	Width = Occupancy.GetWidth();
+	Height = Occupancy.GetHeight();
+	Parent.SetNumUninitialized(Width * Height);
+	Size.SetNumUninitialized(Width * Height);
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		for (int32 X = 0; X < Width; ++X)
+		{
+			const int32 Cell = Y * Width + X;
+			Parent[Cell] = Occupancy.IsOccupied(X, Y) ? INDEX_NONE : Cell;
+			Size[Cell] = 1;
+		}
+	}
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		for (int32 X = 0; X < Width; ++X)
+		{
+			const int32 Cell = Y * Width + X;
+			if (Parent[Cell] == INDEX_NONE)
+			{
+				continue;
+			}
+			if (X > 0 && Parent[Cell - 1] != INDEX_NONE)
+			{
+				Union(Cell, Cell - 1);
+			}
+			if (Y > 0 && Parent[Cell - Width] != INDEX_NONE)
+			{
+				Union(Cell, Cell - Width);
+			}
+		}
+	}
+
+	// Flatten so that later const lookups are one hop for every existing cell.
+	for (int32 Cell = 0; Cell < Parent.Num(); ++Cell)
+	{
+		if (Parent[Cell] != INDEX_NONE)
+		{
+			Parent[Cell] = FindRoot(Cell);
+		}
+	}
+}
+
+void FOnetEmptyRegions::MarkEmpty(const int32 X, const int32 Y)
+{
+	const int32 Cell = Y * Width + X;
+	if (Parent[Cell] != INDEX_NONE)
+	{
+		return;
+	}
+
+	Parent[Cell] = Cell;
+	Size[Cell] = 1;
+
+	const FIntPoint Neighbours[] = {FIntPoint(X - 1, Y), FIntPoint(X + 1, Y), FIntPoint(X, Y - 1), FIntPoint(X, Y + 1)};
+	for (const FIntPoint& Neighbour : Neighbours)
+	{
+		if (Neighbour.X >= 0 && Neighbour.X < Width && Neighbour.Y >= 0 && Neighbour.Y < Height)
+		{
+			const int32 NeighbourCell = Neighbour.Y * Width + Neighbour.X;
+			if (Parent[NeighbourCell] != INDEX_NONE)
+			{
+				Union(Cell, NeighbourCell);
+			}
+		}
+	}
+}
+
+int32 FOnetEmptyRegions::FindRegion(const int32 X, const int32 Y) const
+{
+	const int32 Cell = Y * Width + X;
+	return Parent[Cell] == INDEX_NONE ? INDEX_NONE : FindRoot(Cell);
+}
+
+bool FOnetEmptyRegions::MayConnect(const FIntPoint& A, const FIntPoint& B) const
+{
+	if (FMath::Abs(A.X - B.X) + FMath::Abs(A.Y - B.Y) == 1)
+	{
+		return true;
+	}
+
+	const FIntPoint Offsets[] = {FIntPoint(-1, 0), FIntPoint(1, 0), FIntPoint(0, -1), FIntPoint(0, 1)};
+
+	int32 RegionsA[4];
+	int32 NumRegionsA = 0;
+	for (const FIntPoint& Offset : Offsets)
+	{
+		const FIntPoint Cell = A + Offset;
+		if (Cell.X >= 0 && Cell.X < Width && Cell.Y >= 0 && Cell.Y < Height)
+		{
+			const int32 Region = FindRegion(Cell.X, Cell.Y);
+			if (Region != INDEX_NONE)
+			{
+				RegionsA[NumRegionsA++] = Region;
+			}
+		}
+	}
+
+	for (const FIntPoint& Offset : Offsets)
+	{
+		const FIntPoint Cell = B + Offset;
+		if (Cell.X >= 0 && Cell.X < Width && Cell.Y >= 0 && Cell.Y < Height)
+		{
+			const int32 Region = FindRegion(Cell.X, Cell.Y);
+			for (int32 i = 0; i < NumRegionsA && Region != INDEX_NONE; ++i)
+			{
+				if (RegionsA[i] == Region)
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+int32 FOnetEmptyRegions::FindRoot(int32 Cell) const
+{
+	while (Parent[Cell] != Cell)
+	{
+		Cell = Parent[Cell];
+	}
+	return Cell;
+}
+
+void FOnetEmptyRegions::Union(const int32 CellA, const int32 CellB)
+{
+	int32 RootA = FindRoot(CellA);
+	int32 RootB = FindRoot(CellB);
+	if (RootA == RootB)
+	{
+		return;
+	}
+
+	if (Size[RootA] < Size[RootB])
+	{
+		Swap(RootA, RootB);
+	}
+
+	Parent[RootB] = RootA;
+	Size[RootA] += Size[RootB];
+}
@@ -0,0 +1,198 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bit-packed occupancy of the padded board (bit X of row Y set = cell occupied).
+ *
+ * Only a build input: whoever repopulates a board fills one and rebuilds the free-run table and
+ * the empty regions from it. It answers no link queries; segment and ray tests are O(1) lookups
+ * in FOnetFreeRunTable, which replaced the word-wide span scans this mask once carried.
+ * All coordinates are physical (padding included).
+ */
+struct ONET_API FOnetOccupancyMask
+{
+	// Resize to the given physical dimensions and mark every cell empty.
+	void Reset(int32 InWidth, int32 InHeight);
+
+	// Set or clear the occupied bit of a cell.
+	void SetOccupied(int32 X, int32 Y, bool bOccupied);
+
+	bool IsOccupied(const int32 X, const int32 Y) const
+	{
+		return (Rows[Y * RowWords + (X >> 6)] >> (X & 63)) & 1;
+	}
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+private:
+	// Physical dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Words per row (covers Width bits).
+	int32 RowWords = 0;
+
+	// Row-major bits (Height * RowWords).
+	TArray<uint64> Rows;
+};
+
+/**
+ * Per-cell free-run extents of the padded board.
+ *
+ * For every physical cell we store how many consecutive empty cells start at that cell and
+ * extend left, right, up and down (the cell itself included, so occupied cells store 0).
+ * A straight segment test then is a single comparison, and a ray from an occupied endpoint
+ * is the run of its neighbour.
+ *
+ * Removals update the table locally (only the runs touching the freed cell change), and so does
+ * putting a tile back; anything that repopulates the board rebuilds it from an occupancy mask.
+ * Extents are stored as uint16, which caps boards at 65535 cells per side.
+ */
+struct ONET_API FOnetFreeRunTable
+{
+	struct FCellRuns
+	{
+		uint16 Left = 0;
+		uint16 Right = 0;
+		uint16 Up = 0;
+		uint16 Down = 0;
+	};
+
+	// Rebuild all extents from the occupancy bits (same physical dimensions).
+	void Rebuild(const FOnetOccupancyMask& Occupancy);
+
+	// Mark a cell empty and extend the runs of its row and column through it.
+	void MarkEmpty(int32 X, int32 Y);
+
+	// Mark a cell occupied and cut the runs of its row and column at it (undoes MarkEmpty).
+	void MarkOccupied(int32 X, int32 Y);
+
+	bool IsEmpty(const int32 X, const int32 Y) const
+	{
+		return Runs[Y * Width + X].Right != 0;
+	}
+
+	const FCellRuns& GetRuns(const int32 X, const int32 Y) const
+	{
+		return Runs[Y * Width + X];
+	}
+
+	// Ray query: number of consecutive empty cells next to (X, Y) in direction (DirX, DirY), in O(1).
+	// Exactly one of DirX/DirY must be +-1.
+	int32 CountEmptyRun(int32 X, int32 Y, int32 DirX, int32 DirY) const;
+
+	// Return true if every cell of row Y between FromX and ToX (inclusive) is empty.
+	// An empty range (FromX > ToX) counts as empty.
+	bool IsRowSpanEmpty(const int32 Y, const int32 FromX, const int32 ToX) const
+	{
+		return FromX > ToX || Runs[Y * Width + FromX].Right > ToX - FromX;
+	}
+
+	// Return true if every cell of column X between FromY and ToY (inclusive) is empty.
+	bool IsColumnSpanEmpty(const int32 X, const int32 FromY, const int32 ToY) const
+	{
+		return FromY > ToY || Runs[FromY * Width + X].Down > ToY - FromY;
+	}
+
+	// Shortest link with at most two turns between the occupied cells Start and End (ties broken like
+	// the breadth-first search it replaced).
+	// Corridor rows/columns are limited to one cell around the occupied bounding box [BoundsMin, BoundsMax].
+	bool FindCorridor(const FIntPoint& BoundsMin, const FIntPoint& BoundsMax, const FIntPoint& Start,
+	                  const FIntPoint& End, FIntPoint& OutCornerA, FIntPoint& OutCornerB) const;
+
+	// Call Visit(X, Y) for every occupied cell a link of at most two turns from Start can end on
+	// (same bounds rule as FindCorridor). A cell may be visited more than once.
+	void ForEachReachableCell(const FIntPoint& BoundsMin, const FIntPoint& BoundsMax, const FIntPoint& Start,
+	                          TFunctionRef<void(int32, int32)> Visit) const;
+
+	// Type buckets with at least this many tiles are searched with CollectLinkedPartners instead of
+	// testing every pair of the bucket.
+	static constexpr int32 ReachSearchMinTiles = 64;
+
+	/**
+	 * Cells of type Type that link to the occupied cell Start and have a higher index (Y * Width + X),
+	 * sorted. Every reach hit already ends a link within the FindCorridor bounds, so the result matches
+	 * a pairwise scan without testing any pair.
+	 *
+	 * @param GetType - Tile type at (X, Y), INDEX_NONE for empty cells.
+	 */
+	template <typename GetTypeFunc, typename AllocatorType>
+	void CollectLinkedPartners(const FIntPoint& BoundsMin, const FIntPoint& BoundsMax, const FIntPoint& Start,
+	                           const int32 Type, const GetTypeFunc& GetType,
+	                           TArray<int32, AllocatorType>& OutPartners) const
+	{
+		OutPartners.Reset();
+
+		const int32 StartIndex = Start.Y * Width + Start.X;
+		ForEachReachableCell(BoundsMin, BoundsMax, Start, [&](const int32 X, const int32 Y)
+		{
+			const int32 Hit = Y * Width + X;
+			if (Hit > StartIndex && GetType(X, Y) == Type)
+			{
+				OutPartners.Add(Hit);
+			}
+		});
+
+		// Several rays can hit the same tile.
+		OutPartners.Sort();
+		int32 NumKept = 0;
+		for (int32 i = 0; i < OutPartners.Num(); ++i)
+		{
+			if (i == 0 || OutPartners[i] != OutPartners[i - 1])
+			{
+				OutPartners[NumKept++] = OutPartners[i];
+			}
+		}
+		OutPartners.SetNum(NumKept, EAllowShrinking::No);
+	}
+
+private:
+	// Physical dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Row-major extents, Index = Y * Width + X.
+	TArray<FCellRuns> Runs;
+};
+
+/**
+ * Connected regions of empty cells (4-neighbourhood), padded outer ring included.
+ *
+ * Any link between two tiles runs through empty cells only, so the tiles must either touch
+ * or both border the same empty region. Removals only ever merge regions, which a union-find
+ * handles in near-constant time; a shuffle rebuilds it.
+ *
+ * Find does not compress paths, so queries are const and safe to run from several threads;
+ * union by size keeps the trees shallow and Rebuild flattens them.
+ */
+struct ONET_API FOnetEmptyRegions
+{
+	// Rebuild regions from the occupancy bits (same physical dimensions).
+	void Rebuild(const FOnetOccupancyMask& Occupancy);
+
+	// Turn (X, Y) into an empty cell and merge it with its empty neighbours.
+	void MarkEmpty(int32 X, int32 Y);
+
+	// Region id of an empty cell, INDEX_NONE for occupied cells.
+	int32 FindRegion(int32 X, int32 Y) const;
+
+	// Return true if the occupied cells A and B touch or border a common empty region.
+	// False means no link of any shape can exist between them.
+	bool MayConnect(const FIntPoint& A, const FIntPoint& B) const;
+
+private:
+	// Physical dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Parent links (INDEX_NONE = occupied cell) and region sizes (valid at roots).
+	TArray<int32> Parent;
+	TArray<int32> Size;
+
+	int32 FindRoot(int32 Cell) const;
+	void Union(int32 CellA, int32 CellB);
+};
@@ -0,0 +1,16 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardSnapshot.h"
+
+void FOnetBoardSnapshot::GetCellTypes(TArray<int32>& OutCellTypes) const
+{
+	OutCellTypes.SetNumUninitialized(Width * Height);
+	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+	{
+		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		{
+			OutCellTypes[LogicY * Width + LogicX] = Tiles.GetType((LogicY + 1) * PhysicalWidth + (LogicX + 1));
+		}
+	}
+}
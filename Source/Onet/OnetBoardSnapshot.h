@@ -0,0 +1,55 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardTypes.h"
+#include "OnetTileStorage.h"
+
+/**
+ * Immutable copy of the plain board data at one board version.
+ *
+ * Produced by FOnetBoardCore::GetSnapshot and shared by thread-safe reference counting, so
+ * background workers (hints, solver, analytics, move enumeration) can read a consistent board
+ * without touching the live board or locking the game thread.
+ *
+ * Version increases monotonically with every change to the board; a worker result computed from
+ * a snapshot is stale once FOnetBoardCore::GetBoardVersion moved past Snapshot.Version.
+ */
+struct ONET_API FOnetBoardSnapshot
+{
+	// Board version this snapshot was taken at.
+	uint64 Version = 0;
+
+	// Zobrist hash of the tiles (same as FOnetBoardCore::GetBoardHash at that version).
+	uint64 BoardHash = 0;
+
+	// Logical dimensions, and physical ones (padding included).
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 PhysicalWidth = 0;
+	int32 PhysicalHeight = 0;
+
+	// Packed padded tiles, Index = PhysY * PhysicalWidth + PhysX.
+	FOnetTileStorage Tiles;
+
+	// Shuffle charges.
+	int32 RemainingShuffleUses = 0;
+	int32 MaxShuffleUses = 0;
+
+	bool IsInBounds(const int32 X, const int32 Y) const
+	{
+		return X >= 0 && X < Width && Y >= 0 && Y < Height;
+	}
+
+	// Tile at logical (X, Y); X and Y must be in bounds.
+	FOnetTile GetTile(const int32 X, const int32 Y) const
+	{
+		return Tiles.GetTile((Y + 1) * PhysicalWidth + (X + 1));
+	}
+
+	// Tile type per logical cell (Index = Y * Width + X), INDEX_NONE for empty cells.
+	void GetCellTypes(TArray<int32>& OutCellTypes) const;
+};
+
+using FOnetBoardSnapshotRef = TSharedRef<const FOnetBoardSnapshot, ESPMode::ThreadSafe>;
@@ -0,0 +1,341 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardSolver.h"
+#include "OnetBoardHash.h"
+
+FOnetBoardSolver::FOnetBoardSolver(const int32 InWidth, const int32 InHeight, TArray<int32> InCellTypes)
+	: Width(FMath::Max(0, InWidth))
+	  , Height(FMath::Max(0, InHeight))
+{
+	check(InCellTypes.Num() == Width * Height);
+
+	PhysicalWidth = Width + 2;
+	PhysicalHeight = Height + 2;
+
+	FOnetOccupancyMask Occupancy;
+	Occupancy.Reset(PhysicalWidth, PhysicalHeight);
+
+	CellTypes.Init(INDEX_NONE, PhysicalWidth * PhysicalHeight);
+	CellKeys.SetNumZeroed(PhysicalWidth * PhysicalHeight);
+
+	for (int32 LogicY = 0; LogicY < Height; ++LogicY)
+	{
+		for (int32 LogicX = 0; LogicX < Width; ++LogicX)
+		{
+			const int32 Type = InCellTypes[LogicY * Width + LogicX];
+			if (Type == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const int32 Cell = (LogicY + 1) * PhysicalWidth + (LogicX + 1);
+			CellTypes[Cell] = Type;
+			CellKeys[Cell] = FOnetZobrist::GetTileKey(LogicX, LogicY, Type);
+			Occupancy.SetOccupied(LogicX + 1, LogicY + 1, true);
+
+			if (CellsByType.Num() <= Type)
+			{
+				CellsByType.SetNum(Type + 1);
+				AliveByType.SetNumZeroed(Type + 1);
+			}
+			CellsByType[Type].Add(Cell);
+			++AliveByType[Type];
+			++RemainingTiles;
+			Hash ^= CellKeys[Cell];
+		}
+	}
+
+	Runs.Rebuild(Occupancy);
+}
+
+namespace
+{
+	TArray<int32> GetSnapshotCellTypes(const FOnetBoardSnapshot& Snapshot)
+	{
+		TArray<int32> CellTypes;
+		Snapshot.GetCellTypes(CellTypes);
+		return CellTypes;
+	}
+}
+
+FOnetBoardSolver::FOnetBoardSolver(const FOnetBoardSnapshot& Snapshot)
+	: FOnetBoardSolver(Snapshot.Width, Snapshot.Height, GetSnapshotCellTypes(Snapshot))
+{
+}
+
+/**
+ * Iterative depth-first search (worker threads have small stacks, and a clearing sequence of a
+ * large board is thousands of moves deep).
+ */
+FOnetSolveResult FOnetBoardSolver::Solve(const double TimeBudgetSeconds, const FOnetSolveControl* Control,
+                                         const FProgressCallback& OnProgress)
+{
+	FOnetSolveResult Result;
+
+	ActiveControl = Control;
+	StartTime = FPlatformTime::Seconds();
+	TimeBudget = TimeBudgetSeconds;
+	NextProgressTime = StartTime + ProgressInterval;
+	ProgressCallback = OnProgress ? &OnProgress : nullptr;
+	StepsUntilPoll = 0;
+	NodesExpanded = 0;
+	StopOutcome.Reset();
+
+	Frames.Reset();
+	Depth = 0;
+
+	bool bSolved = RemainingTiles == 0;
+
+	// A type with an odd number of tiles can never be cleared; no search needed for that proof.
+	bool bParityBroken = false;
+	for (const int32 Alive : AliveByType)
+	{
+		bParityBroken |= (Alive & 1) != 0;
+	}
+
+	if (!bSolved && !bParityBroken)
+	{
+		Expand();
+		++NodesExpanded;
+	}
+
+	while (!bSolved && Depth > 0)
+	{
+		// Counted per step rather than per expansion: backtracking and table hits expand nothing.
+		if (PollStop())
+		{
+			break;
+		}
+
+		FFrame& Frame = Frames[Depth - 1];
+		if (Frame.bApplied)
+		{
+			UndoMove(Frame.Moves[Frame.Next - 1]);
+			Frame.bApplied = false;
+		}
+
+		// Every move of this position failed: it cannot be cleared.
+		if (Frame.Next >= Frame.Moves.Num())
+		{
+			if (RefutedHashes.Num() < MaxTableEntries)
+			{
+				RefutedHashes.Add(Frame.Hash);
+			}
+			--Depth;
+			continue;
+		}
+
+		ApplyMove(Frame.Moves[Frame.Next++]);
+		Frame.bApplied = true;
+
+		if (RemainingTiles == 0)
+		{
+			bSolved = true;
+			break;
+		}
+
+		if (!RefutedHashes.Contains(Hash))
+		{
+			Expand();
+			++NodesExpanded;
+		}
+	}
+
+	if (bSolved)
+	{
+		Result.Outcome = EOnetSolveOutcome::Solved;
+		Result.Moves.Reserve(Depth);
+		for (int32 Level = 0; Level < Depth; ++Level)
+		{
+			const FMove& Move = Frames[Level].Moves[Frames[Level].Next - 1];
+			const FIntPoint A = ToPhysical(Move.CellA);
+			const FIntPoint B = ToPhysical(Move.CellB);
+			Result.Moves.Emplace(FIntPoint(A.X - 1, A.Y - 1), FIntPoint(B.X - 1, B.Y - 1)); // Convert to logical
+		}
+	}
+	else
+	{
+		Result.Outcome = StopOutcome.Get(EOnetSolveOutcome::Stuck);
+	}
+
+	// Put the position back so that the solver can be run again.
+	for (int32 Level = Depth - 1; Level >= 0; --Level)
+	{
+		if (Frames[Level].bApplied)
+		{
+			UndoMove(Frames[Level].Moves[Frames[Level].Next - 1]);
+			Frames[Level].bApplied = false;
+		}
+	}
+	Depth = 0;
+
+	ActiveControl = nullptr;
+	ProgressCallback = nullptr;
+
+	Result.NodesExpanded = NodesExpanded;
+	Result.RefutedPositions = RefutedHashes.Num();
+	Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	Result.NodesPerSecond = Result.NodesExpanded / FMath::Max(Result.ElapsedSeconds, UE_SMALL_NUMBER);
+	return Result;
+}
+
+bool FOnetBoardSolver::PollStop()
+{
+	if (StopOutcome.IsSet())
+	{
+		return true;
+	}
+
+	if (--StepsUntilPoll > 0)
+	{
+		return false;
+	}
+	StepsUntilPoll = FMath::Max(1, PollInterval);
+
+	if (ActiveControl && ActiveControl->bCancelRequested.load(std::memory_order_relaxed))
+	{
+		StopOutcome = EOnetSolveOutcome::Cancelled;
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (TimeBudget > 0.0 && Now - StartTime >= TimeBudget)
+	{
+		StopOutcome = EOnetSolveOutcome::TimedOut;
+		return true;
+	}
+
+	if (ProgressCallback && Now >= NextProgressTime)
+	{
+		(*ProgressCallback)(NodesExpanded, NodesExpanded / FMath::Max(Now - StartTime, UE_SMALL_NUMBER));
+		NextProgressTime = Now + ProgressInterval;
+	}
+	return false;
+}
+
+/**
+ * Push a frame holding every linkable pair of the current position.
+ * If a type is down to its last two tiles and they link, that pair is the frame's only move.
+ * Big buckets flood each tile's reach instead of testing every pair, so one expansion of a huge
+ * board stays linear in its tiles; the clock and cancel flag are polled throughout.
+ */
+void FOnetBoardSolver::Expand()
+{
+	if (Frames.Num() <= Depth)
+	{
+		Frames.AddDefaulted();
+	}
+
+	FFrame& Frame = Frames[Depth++];
+	Frame.Moves.Reset();
+	Frame.Next = 0;
+	Frame.bApplied = false;
+	Frame.Hash = Hash;
+
+	// Any link stays inside the box around the original tiles.
+	const FIntPoint BoundsMin(1, 1);
+	const FIntPoint BoundsMax(Width, Height);
+
+	auto GetType = [this](const int32 PhysX, const int32 PhysY) { return CellTypes[PhysY * PhysicalWidth + PhysX]; };
+
+	for (int32 Type = 0; Type < CellsByType.Num(); ++Type)
+	{
+		if (AliveByType[Type] < 2)
+		{
+			continue;
+		}
+
+		TypeCells.Reset();
+		for (const int32 Cell : CellsByType[Type])
+		{
+			if (CellTypes[Cell] == Type)
+			{
+				TypeCells.Add(Cell);
+			}
+		}
+
+		if (TypeCells.Num() >= FOnetFreeRunTable::ReachSearchMinTiles)
+		{
+			for (const int32 Cell : TypeCells)
+			{
+				if (PollStop())
+				{
+					return;
+				}
+
+				Runs.CollectLinkedPartners(BoundsMin, BoundsMax, ToPhysical(Cell), Type, GetType, Partners);
+				for (const int32 Partner : Partners)
+				{
+					FMove Move;
+					Move.CellA = Cell;
+					Move.CellB = Partner;
+					Move.Type = Type;
+					Frame.Moves.Add(Move);
+				}
+			}
+			continue;
+		}
+
+		for (int32 i = 0; i < TypeCells.Num(); ++i)
+		{
+			for (int32 j = i + 1; j < TypeCells.Num(); ++j)
+			{
+				if (PollStop())
+				{
+					return;
+				}
+
+				FIntPoint CornerA;
+				FIntPoint CornerB;
+				if (!Runs.FindCorridor(BoundsMin, BoundsMax, ToPhysical(TypeCells[i]), ToPhysical(TypeCells[j]),
+				                       CornerA, CornerB))
+				{
+					continue;
+				}
+
+				FMove Move;
+				Move.CellA = TypeCells[i];
+				Move.CellB = TypeCells[j];
+				Move.Type = Type;
+
+				if (TypeCells.Num() == 2)
+				{
+					Frame.Moves.Reset();
+					Frame.Moves.Add(Move);
+					return;
+				}
+
+				Frame.Moves.Add(Move);
+			}
+		}
+	}
+}
+
+void FOnetBoardSolver::ApplyMove(const FMove& Move)
+{
+	for (const int32 Cell : {Move.CellA, Move.CellB})
+	{
+		const FIntPoint Phys = ToPhysical(Cell);
+		CellTypes[Cell] = INDEX_NONE;
+		Runs.MarkEmpty(Phys.X, Phys.Y);
+		Hash ^= CellKeys[Cell];
+	}
+
+	AliveByType[Move.Type] -= 2;
+	RemainingTiles -= 2;
+}
+
+void FOnetBoardSolver::UndoMove(const FMove& Move)
+{
+	for (const int32 Cell : {Move.CellB, Move.CellA})
+	{
+		const FIntPoint Phys = ToPhysical(Cell);
+		CellTypes[Cell] = Move.Type;
+		Runs.MarkOccupied(Phys.X, Phys.Y);
+		Hash ^= CellKeys[Cell];
+	}
+
+	AliveByType[Move.Type] += 2;
+	RemainingTiles += 2;
+}
@@ -0,0 +1,157 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardTypes.h"
+#include "OnetBoardOccupancy.h"
+#include "OnetBoardSnapshot.h"
+
+#include <atomic>
+
+/**
+ * Shared between the thread that requested a solve and the thread running it.
+ */
+struct FOnetSolveControl
+{
+	std::atomic<bool> bCancelRequested{false};
+};
+
+/**
+ * Outcome of a solve, plus the clearing sequence when one was found.
+ */
+struct FOnetSolveResult
+{
+	EOnetSolveOutcome Outcome = EOnetSolveOutcome::Stuck;
+
+	// Pairs to remove, in order (logical coordinates). Only filled when Outcome is Solved.
+	TArray<FOnetTilePair> Moves;
+
+	// Positions expanded and positions proven unclearable (transposition table size).
+	int64 NodesExpanded = 0;
+	int32 RefutedPositions = 0;
+
+	double ElapsedSeconds = 0.0;
+	double NodesPerSecond = 0.0;
+};
+
+/**
+ * Depth-first solver for a board position.
+ *
+ * Works on its own copy of the position, so it can run on any thread.
+ * - Removing a pair only ever frees cells, so the only decision that can lose a won position is
+ *   which tiles of a type get paired. A type with exactly two linkable tiles left is therefore
+ *   removed without branching.
+ * - Positions proven unclearable are remembered by their Zobrist hash (the same fingerprint as
+ *   FOnetBoardCore::GetBoardHash), so every position is refuted at most once whatever order
+ *   led to it.
+ * An exhausted search is the proof that the position is stuck.
+ */
+class ONET_API FOnetBoardSolver
+{
+public:
+	/**
+	 * @param InWidth - Logical width.
+	 * @param InHeight - Logical height.
+	 * @param InCellTypes - Tile type per logical cell (Index = Y * Width + X), INDEX_NONE for empty cells.
+	 */
+	FOnetBoardSolver(int32 InWidth, int32 InHeight, TArray<int32> InCellTypes);
+
+	// Solve the position held by a board snapshot.
+	explicit FOnetBoardSolver(const FOnetBoardSnapshot& Snapshot);
+
+	// Called from the solving thread roughly every ProgressInterval seconds with (nodes expanded, nodes per second).
+	using FProgressCallback = TFunction<void(int64, double)>;
+
+	/**
+	 * Search for a clearing sequence.
+	 *
+	 * @param TimeBudgetSeconds - Wall-clock limit (<= 0 means unlimited).
+	 * @param Control - Optional cancellation flag, polled while searching.
+	 * @param OnProgress - Optional progress report.
+	 */
+	FOnetSolveResult Solve(double TimeBudgetSeconds, const FOnetSolveControl* Control = nullptr,
+	                       const FProgressCallback& OnProgress = nullptr);
+
+	// Stop remembering refuted positions beyond this many entries (bounds memory on huge searches).
+	int32 MaxTableEntries = 1 << 22;
+
+	// Seconds between two progress reports.
+	double ProgressInterval = 0.25;
+
+	// Search steps (backtracks, table hits and pair tests included) between two checks of the clock
+	// and the cancel flag.
+	int32 PollInterval = 256;
+
+private:
+	struct FMove
+	{
+		int32 CellA = INDEX_NONE;
+		int32 CellB = INDEX_NONE;
+		int32 Type = INDEX_NONE;
+	};
+
+	struct FFrame
+	{
+		TArray<FMove> Moves;
+		int32 Next = 0;
+		bool bApplied = false;
+		uint64 Hash = 0;
+	};
+
+	// Logical and physical (padded) dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 PhysicalWidth = 0;
+	int32 PhysicalHeight = 0;
+
+	// Current type per physical cell (INDEX_NONE = empty) and occupied cells per type.
+	TArray<int32> CellTypes;
+	TArray<TArray<int32>> CellsByType;
+	TArray<int32> AliveByType;
+	int32 RemainingTiles = 0;
+
+	// Free runs of the current position, updated on apply/undo.
+	FOnetFreeRunTable Runs;
+
+	// Zobrist key of each physical cell's original tile and hash of the current position.
+	TArray<uint64> CellKeys;
+	uint64 Hash = 0;
+
+	// Hashes of positions that cannot be cleared.
+	TSet<uint64> RefutedHashes;
+
+	// Search stack; frames are reused across the search to keep their move arrays.
+	TArray<FFrame> Frames;
+	int32 Depth = 0;
+
+	// Scratch list of alive cells of one type, and of one cell's linked partners.
+	TArray<int32> TypeCells;
+	TArray<int32, TInlineAllocator<32>> Partners;
+
+	// Stop conditions of the running Solve; StopOutcome is set once it has to stop.
+	const FOnetSolveControl* ActiveControl = nullptr;
+	double StartTime = 0.0;
+	double TimeBudget = 0.0;
+	double NextProgressTime = 0.0;
+	const FProgressCallback* ProgressCallback = nullptr;
+	int32 StepsUntilPoll = 0;
+	int64 NodesExpanded = 0;
+	TOptional<EOnetSolveOutcome> StopOutcome;
+
+	// Count one search step; every PollInterval steps, check the cancel flag and the time budget
+	// and report progress. Returns true once the search has to stop.
+	bool PollStop();
+
+	// Fill the next frame with the moves of the current position. May stop early (PollStop); the
+	// partial frame is then never used.
+	void Expand();
+
+	void ApplyMove(const FMove& Move);
+	void UndoMove(const FMove& Move);
+
+	FIntPoint ToPhysical(const int32 Cell) const
+	{
+		return FIntPoint(Cell % PhysicalWidth, Cell / PhysicalWidth);
+	}
+};
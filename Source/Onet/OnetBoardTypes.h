@@ -0,0 +1,109 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardTypes.generated.h"
+
+/**
+ * A single tile on the Onet game board.
+ * 
+ * Members:
+ * - TileTypeId: An integer representing the type of the tile. If not defined, it defaults to INDEX_NONE.
+ * - bEmpty: A boolean indicating whether the tile is empty (true) or occupied (false).
+ */
+USTRUCT(BlueprintType)
+struct FOnetTile
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
+	int32 TileTypeId = INDEX_NONE; // Type identifier for the tile. If it is not defined, it is set to INDEX_NONE.
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
+	bool bEmpty = true; // Indicates whether the tile is empty or occupied.
+};
+
+/**
+ * A pair of logical tile coordinates, e.g. a candidate or available move.
+ */
+USTRUCT(BlueprintType)
+struct FOnetTilePair
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
+	FIntPoint First = FIntPoint(-1, -1);
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Onet|Board")
+	FIntPoint Second = FIntPoint(-1, -1);
+
+	FOnetTilePair() = default;
+
+	FOnetTilePair(const FIntPoint& InFirst, const FIntPoint& InSecond)
+		: First(InFirst), Second(InSecond)
+	{
+	}
+};
+
+/**
+ * How a new board lays out tile types.
+ *
+ * - RandomBag: shuffle a bag of pairs into the grid; the board may start deadlocked or be unclearable.
+ * - SolvableByConstruction: place pairs in reverse removal order so the board can always be cleared.
+ */
+UENUM(BlueprintType)
+enum class EOnetBoardGeneration : uint8
+{
+	RandomBag,
+	SolvableByConstruction
+};
+
+/**
+ * How a shuffle redistributes the remaining tiles.
+ *
+ * - Random: uniform permutation; the result may still be deadlocked and need another charge.
+ * - GuaranteedMoves: seed a number of always-linkable pairs first, then fill the rest randomly.
+ * - BestOfCandidates: score several random permutations on worker threads and keep the one with the most moves.
+ */
+UENUM(BlueprintType)
+enum class EOnetShuffleMode : uint8
+{
+	Random,
+	GuaranteedMoves,
+	BestOfCandidates
+};
+
+/**
+ * What happened to the cells of a board-change delta.
+ *
+ * - Removed: the cells were emptied (a matched pair).
+ * - Retyped: the cells hold a different tile than before, or none (a shuffle).
+ * - Reset: every cell may have changed; the cell list is empty.
+ */
+UENUM(BlueprintType)
+enum class EOnetCellChangeKind : uint8
+{
+	Removed,
+	Retyped,
+	Reset
+};
+
+/**
+ * Result of a solver run (see FOnetBoardSolver).
+ *
+ * - Solved: a clearing sequence was found.
+ * - Stuck: the search was exhausted; the position cannot be cleared without a shuffle.
+ * - TimedOut / Cancelled: the search stopped early; nothing is known.
+ * - Stale: the board changed before the result arrived, so it was dropped (reported by
+ *   UOnetBoardComponent only; the solver itself never returns it).
+ */
+UENUM(BlueprintType)
+enum class EOnetSolveOutcome : uint8
+{
+	Solved,
+	Stuck,
+	TimedOut,
+	Cancelled,
+	Stale
+};
@@ -0,0 +1,171 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetBoardView.h"
+#include "OnetBoardComponent.h"
+#include "SOnetBoardView.h"
+
+TSharedRef<SWidget> UOnetBoardView::RebuildWidget()
+{
+	MyBoardView = SNew(SOnetBoardView)
+		.Board(Board.Get())
+		.TileSize(TileSize)
+		.TilePadding(TilePadding)
+		.NormalColor(NormalColor)
+		.SelectedColor(SelectedColor)
+		.HintColor(HintColor)
+		.PartnerColor(PartnerColor)
+		.LabelColor(LabelColor)
+		.PathColor(PathColor)
+		.PathThickness(PathThickness)
+		.Font(LabelFont.HasValidFont() ? TOptional<FSlateFontInfo>(LabelFont) : TOptional<FSlateFontInfo>())
+		.OnCellClicked(FOnetBoardViewCellClicked::CreateUObject(this, &UOnetBoardView::HandleCellClicked));
+
+	SyncHighlights();
+	return MyBoardView.ToSharedRef();
+}
+
+void UOnetBoardView::ReleaseSlateResources(const bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyBoardView.Reset();
+}
+
+/**
+ * Attach the view to a board component.
+ * @param InBoard - Board to display, or null to detach.
+ */
+void UOnetBoardView::SetBoard(UOnetBoardComponent* InBoard)
+{
+	UnbindBoardEvents();
+	Board = InBoard;
+	BindBoardEvents();
+
+	if (MyBoardView)
+	{
+		MyBoardView->SetBoard(Board.Get());
+		SyncHighlights();
+	}
+}
+
+void UOnetBoardView::BindBoardEvents()
+{
+	if (!Board)
+	{
+		return;
+	}
+
+	Board->OnBoardChangedNative.AddUObject(this, &UOnetBoardView::HandleBoardChanged);
+	Board->OnCellsChangedNative.AddUObject(this, &UOnetBoardView::HandleCellsChanged);
+	Board->OnSelectionChangedNative.AddUObject(this, &UOnetBoardView::HandleSelectionChanged);
+	Board->OnSelectionPartnersChangedNative.AddUObject(this, &UOnetBoardView::HandleSelectionPartnersChanged);
+	Board->OnMatchSuccessfulNative.AddUObject(this, &UOnetBoardView::HandleMatchSuccessful);
+	Board->OnHintUpdatedNative.AddUObject(this, &UOnetBoardView::HandleHintUpdated);
+}
+
+void UOnetBoardView::UnbindBoardEvents()
+{
+	if (!Board)
+	{
+		return;
+	}
+
+	Board->OnBoardChangedNative.RemoveAll(this);
+	Board->OnCellsChangedNative.RemoveAll(this);
+	Board->OnSelectionChangedNative.RemoveAll(this);
+	Board->OnSelectionPartnersChangedNative.RemoveAll(this);
+	Board->OnMatchSuccessfulNative.RemoveAll(this);
+	Board->OnHintUpdatedNative.RemoveAll(this);
+}
+
+void UOnetBoardView::SyncHighlights()
+{
+	if (!MyBoardView || !Board)
+	{
+		return;
+	}
+
+	FIntPoint Selection;
+	const bool bHasSelection = Board->GetFirstSelection(Selection);
+	MyBoardView->SetSelection(bHasSelection, Selection);
+
+	TArray<FIntPoint> Partners;
+	Board->GetSelectionPartners(Partners);
+	MyBoardView->SetPartners(Partners);
+
+	FIntPoint HintFirst;
+	FIntPoint HintSecond;
+	const bool bHasHint = Board->HasActiveHint(HintFirst, HintSecond);
+	MyBoardView->SetHint(bHasHint, HintFirst, HintSecond);
+}
+
+/**
+ * Clicks on a tile drive the board's selection; clicks between or around tiles clear it,
+ * like background clicks on UOnetBoardWidget.
+ */
+void UOnetBoardView::HandleCellClicked(const FIntPoint Cell)
+{
+	if (!Board)
+	{
+		return;
+	}
+
+	if (Cell.X >= 0 && Cell.Y >= 0)
+	{
+		Board->HandleTileClicked(Cell.X, Cell.Y);
+	}
+	else
+	{
+		Board->ClearSelection();
+	}
+}
+
+void UOnetBoardView::HandleBoardChanged()
+{
+	if (MyBoardView)
+	{
+		MyBoardView->RefreshBoard();
+		SyncHighlights();
+	}
+}
+
+void UOnetBoardView::HandleCellsChanged(EOnetCellChangeKind, TConstArrayView<FIntPoint>)
+{
+	// One paint covers every tile, so the cell list is not needed.
+	if (MyBoardView)
+	{
+		MyBoardView->RefreshBoard();
+	}
+}
+
+void UOnetBoardView::HandleSelectionChanged(const bool bHasFirstSelection, const FIntPoint& FirstSelection)
+{
+	if (MyBoardView)
+	{
+		MyBoardView->SetSelection(bHasFirstSelection, FirstSelection);
+	}
+}
+
+void UOnetBoardView::HandleSelectionPartnersChanged(const TConstArrayView<FIntPoint> Partners)
+{
+	if (MyBoardView)
+	{
+		MyBoardView->SetPartners(Partners);
+	}
+}
+
+void UOnetBoardView::HandleMatchSuccessful(const TConstArrayView<FIntPoint> Path)
+{
+	if (MyBoardView)
+	{
+		MyBoardView->ShowPath(Path, PathDisplayDuration);
+	}
+}
+
+void UOnetBoardView::HandleHintUpdated(const bool bHasHint, const FIntPoint& First, const FIntPoint& Second)
+{
+	if (MyBoardView)
+	{
+		MyBoardView->SetHint(bHasHint, First, Second);
+	}
+}
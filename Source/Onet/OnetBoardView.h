@@ -0,0 +1,93 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "OnetBoardTypes.h"
+#include "OnetBoardView.generated.h"
+
+class SOnetBoardView;
+class UOnetBoardComponent;
+
+/**
+ * UMG wrapper of SOnetBoardView: a whole board in one widget, for boards too large for
+ * UOnetBoardWidget's widget-per-tile grid (from roughly 30x30 up).
+ *
+ * Listens to the board through its native delegates, pushes highlight state to the Slate view
+ * and forwards clicks to UOnetBoardComponent::HandleTileClicked (ClearSelection off the tiles).
+ */
+UCLASS()
+class ONET_API UOnetBoardView : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	// Show and control Board (null detaches the view).
+	UFUNCTION(BlueprintCallable, Category = "Onet|Board")
+	void SetBoard(UOnetBoardComponent* InBoard);
+
+	UFUNCTION(BlueprintPure, Category = "Onet|Board")
+	UOnetBoardComponent* GetBoard() const { return Board; }
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	// Desired tile size and the gap on each side of a tile; the board is scaled to fit.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI", meta = (ClampMin = "1"))
+	float TileSize = 32.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI", meta = (ClampMin = "0"))
+	float TilePadding = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor NormalColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor SelectedColor = FLinearColor(1.0f, 1.0f, 0.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor HintColor = FLinearColor(0.5f, 0.8f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor PartnerColor = FLinearColor(0.6f, 1.0f, 0.6f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor LabelColor = FLinearColor::Black;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FSlateFontInfo LabelFont;
+
+	// Connection line shown after a successful match.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	FLinearColor PathColor = FLinearColor::Green;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	float PathThickness = 4.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Onet|UI")
+	float PathDisplayDuration = 0.5f;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UOnetBoardComponent> Board;
+
+	TSharedPtr<SOnetBoardView> MyBoardView;
+
+	void BindBoardEvents();
+	void UnbindBoardEvents();
+
+	// Push the board's current selection, partners and hint to the Slate view.
+	void SyncHighlights();
+
+	void HandleCellClicked(FIntPoint Cell);
+
+	void HandleBoardChanged();
+	void HandleCellsChanged(EOnetCellChangeKind Kind, TConstArrayView<FIntPoint> Cells);
+	void HandleSelectionChanged(bool bHasFirstSelection, const FIntPoint& FirstSelection);
+	void HandleSelectionPartnersChanged(TConstArrayView<FIntPoint> Partners);
+	void HandleMatchSuccessful(TConstArrayView<FIntPoint> Path);
+	void HandleHintUpdated(bool bHasHint, const FIntPoint& First, const FIntPoint& Second);
+};
@@ -119,6 +119,7 @@ FReply UOnetBoardWidget::NativeOnMouseButtonDown(const FGeometry& InGeometry, co
  */
 void UOnetBoardWidget::InitializeWithBoard(UOnetBoardComponent* InBoard)
 {
+	UnbindBoardEvents();
 	Board = InBoard;
 
 	if (!Board)
@@ -133,15 +134,7 @@ void UOnetBoardWidget::InitializeWithBoard(UOnetBoardComponent* InBoard)
 	}
 
 	// Subscribe to board events so UI updates can be event-driven.
-	Board->OnBoardChanged.AddDynamic(this, &UOnetBoardWidget::HandleBoardChanged);
-	Board->OnSelectionChanged.AddDynamic(this, &UOnetBoardWidget::HandleSelectionChanged);
-	Board->OnMatchSuccessful.AddDynamic(this, &UOnetBoardWidget::HandleMatchSuccessful);
-	Board->OnMatchFailed.AddDynamic(this, &UOnetBoardWidget::HandleMatchFailed);
-	Board->OnShufflePerformed.AddDynamic(this, &UOnetBoardWidget::HandleShuffleUpdated);
-	Board->OnHintUpdated.AddDynamic(this, &UOnetBoardWidget::HandleHintUpdated);
-	Board->OnWildStateChanged.AddDynamic(this, &UOnetBoardWidget::HandleWildStateChanged);
-	Board->OnBoardCleared.AddDynamic(this, &UOnetBoardWidget::HandleBoardCleared);
-	Board->OnNoMovesRemain.AddDynamic(this, &UOnetBoardWidget::HandleNoMovesRemain);
+	BindBoardEvents();
 
 	CachedRemainingShuffles = Board->GetRemainingShuffleUses();
 	CachedMaxShuffles = Board->GetMaxShuffleUses();
@@ -157,6 +150,45 @@ void UOnetBoardWidget::InitializeWithBoard(UOnetBoardComponent* InBoard)
 	UpdateActionButtons();
 }
 
+/**
+ * The widget listens through the native delegates: no reflection per event, and paths and cell
+ * lists arrive as views instead of marshalled arrays.
+ */
+void UOnetBoardWidget::BindBoardEvents()
+{
+	Board->OnBoardChangedNative.AddUObject(this, &UOnetBoardWidget::HandleBoardChanged);
+	Board->OnCellsChangedNative.AddUObject(this, &UOnetBoardWidget::HandleCellsChanged);
+	Board->OnSelectionChangedNative.AddUObject(this, &UOnetBoardWidget::HandleSelectionChanged);
+	Board->OnSelectionPartnersChangedNative.AddUObject(this, &UOnetBoardWidget::HandleSelectionPartnersChanged);
+	Board->OnMatchSuccessfulNative.AddUObject(this, &UOnetBoardWidget::HandleMatchSuccessful);
+	Board->OnMatchFailedNative.AddUObject(this, &UOnetBoardWidget::HandleMatchFailed);
+	Board->OnShufflePerformedNative.AddUObject(this, &UOnetBoardWidget::HandleShuffleUpdated);
+	Board->OnHintUpdatedNative.AddUObject(this, &UOnetBoardWidget::HandleHintUpdated);
+	Board->OnWildStateChangedNative.AddUObject(this, &UOnetBoardWidget::HandleWildStateChanged);
+	Board->OnBoardClearedNative.AddUObject(this, &UOnetBoardWidget::HandleBoardCleared);
+	Board->OnNoMovesRemainNative.AddUObject(this, &UOnetBoardWidget::HandleNoMovesRemain);
+}
+
+void UOnetBoardWidget::UnbindBoardEvents()
+{
+	if (!Board)
+	{
+		return;
+	}
+
+	Board->OnBoardChangedNative.RemoveAll(this);
+	Board->OnCellsChangedNative.RemoveAll(this);
+	Board->OnSelectionChangedNative.RemoveAll(this);
+	Board->OnSelectionPartnersChangedNative.RemoveAll(this);
+	Board->OnMatchSuccessfulNative.RemoveAll(this);
+	Board->OnMatchFailedNative.RemoveAll(this);
+	Board->OnShufflePerformedNative.RemoveAll(this);
+	Board->OnHintUpdatedNative.RemoveAll(this);
+	Board->OnWildStateChangedNative.RemoveAll(this);
+	Board->OnBoardClearedNative.RemoveAll(this);
+	Board->OnNoMovesRemainNative.RemoveAll(this);
+}
+
 void UOnetBoardWidget::RebuildGrid()
 {
 	if (!GridPanel || !Board || !TileWidgetClass)
@@ -216,21 +248,37 @@ void UOnetBoardWidget::RefreshAllTiles()
 	{
 		for (int32 X = 0; X < W; ++X)
 		{
-			FOnetTile TileData;
-			if (!Board->GetTile(X, Y, TileData))
-			{
-				continue;
-			}
+			RefreshTile(X, Y);
+		}
+	}
+}
+
+/**
+ * Push the board data and highlight state of one cell to its tile widget.
+ */
+void UOnetBoardWidget::RefreshTile(const int32 X, const int32 Y)
+{
+	FOnetTile TileData;
+	if (!Board || !Board->GetTile(X, Y, TileData))
+	{
+		return;
+	}
+
+	const int32 W = Board->GetBoardWidth();
+	if (!TileWidgets.IsValidIndex(Y * W + X))
+	{
+		return;
+	}
 
-			const bool bIsSelected = bHasSelection && (X == SelectedX) && (Y == SelectedY);
-			const bool bIsHintTile = bHasHintTiles && ((X == HintTileA.X && Y == HintTileA.Y) ||
-				(X == HintTileB.X && Y == HintTileB.Y));
+	const bool bIsSelected = bHasSelection && (X == SelectedX) && (Y == SelectedY);
+	const bool bIsHintTile = bHasHintTiles && ((X == HintTileA.X && Y == HintTileA.Y) ||
+		(X == HintTileB.X && Y == HintTileB.Y));
 
-			if (UOnetTileWidget* TileWidget = TileWidgets[Y * W + X])
-			{
-				TileWidget->SetTileVisual(TileData.bEmpty, TileData.TileTypeId, bIsSelected, bIsHintTile);
-			}
-		}
+	const bool bIsPartnerTile = PartnerTiles.IsValidIndex(Y * W + X) && PartnerTiles[Y * W + X];
+
+	if (UOnetTileWidget* TileWidget = TileWidgets[Y * W + X])
+	{
+		TileWidget->SetTileVisual(TileData.bEmpty, TileData.TileTypeId, bIsSelected, bIsHintTile, bIsPartnerTile);
 	}
 }
 
@@ -310,16 +358,92 @@ void UOnetBoardWidget::HandleBoardChanged()
 	UpdateActionButtons();
 }
 
-void UOnetBoardWidget::HandleSelectionChanged(const bool bHasFirstSelection, const FIntPoint FirstSelection)
+void UOnetBoardWidget::HandleCellsChanged(const EOnetCellChangeKind Kind, const TConstArrayView<FIntPoint> Cells)
+{
+	if (!Board || !GridPanel)
+	{
+		return;
+	}
+
+	// A reset always follows OnBoardChanged, which already repainted every tile.
+	if (Kind == EOnetCellChangeKind::Reset)
+	{
+		return;
+	}
+
+	if (TileWidgets.Num() != Board->GetBoardWidth() * Board->GetBoardHeight())
+	{
+		HandleBoardChanged();
+		return;
+	}
+
+	for (const FIntPoint& Cell : Cells)
+	{
+		RefreshTile(Cell.X, Cell.Y);
+	}
+}
+
+/**
+ * Highlight handlers repaint only the tiles whose highlight changed: the old and the new ones.
+ */
+void UOnetBoardWidget::HandleSelectionChanged(const bool bHasFirstSelection, const FIntPoint& FirstSelection)
 {
+	const bool bHadSelection = bHasSelection;
+	const int32 PreviousX = SelectedX;
+	const int32 PreviousY = SelectedY;
+
 	bHasSelection = bHasFirstSelection;
 	SelectedX = bHasSelection ? FirstSelection.X : -1;
 	SelectedY = bHasSelection ? FirstSelection.Y : -1;
 
-	RefreshAllTiles();
+	if (bHadSelection)
+	{
+		RefreshTile(PreviousX, PreviousY);
+	}
+	if (bHasSelection && (!bHadSelection || SelectedX != PreviousX || SelectedY != PreviousY))
+	{
+		RefreshTile(SelectedX, SelectedY);
+	}
+}
+
+void UOnetBoardWidget::HandleSelectionPartnersChanged(const TConstArrayView<FIntPoint> Partners)
+{
+	if (!Board)
+	{
+		return;
+	}
+
+	const int32 W = Board->GetBoardWidth();
+	const int32 NumCells = W * Board->GetBoardHeight();
+	if (W <= 0)
+	{
+		return;
+	}
+
+	// Clear the old highlights and repaint them, then set and repaint the new ones.
+	TArray<int32> PreviousPartners;
+	for (TConstSetBitIterator<> It(PartnerTiles); It; ++It)
+	{
+		PreviousPartners.Add(It.GetIndex());
+	}
+
+	PartnerTiles.Init(false, NumCells);
+	for (const int32 Index : PreviousPartners)
+	{
+		RefreshTile(Index % W, Index / W);
+	}
+
+	for (const FIntPoint& Partner : Partners)
+	{
+		if (PartnerTiles.IsValidIndex(Partner.Y * W + Partner.X))
+		{
+			PartnerTiles[Partner.Y * W + Partner.X] = true;
+			RefreshTile(Partner.X, Partner.Y);
+		}
+	}
 }
 
-void UOnetBoardWidget::HandleMatchSuccessful(const TArray<FIntPoint>& Path)
+void UOnetBoardWidget::HandleMatchSuccessful(const TConstArrayView<FIntPoint> Path)
 {
 	// Draw the connection path in C++.
 	DrawConnectionPath(Path);
@@ -382,12 +506,26 @@ void UOnetBoardWidget::HandleShuffleUpdated(int32 RemainingUses, bool bAutoTrigg
 	}
 }
 
-void UOnetBoardWidget::HandleHintUpdated(bool bHasHint, FIntPoint First, FIntPoint Second)
+void UOnetBoardWidget::HandleHintUpdated(const bool bHasHint, const FIntPoint& First, const FIntPoint& Second)
 {
+	const bool bHadHintTiles = bHasHintTiles;
+	const FIntPoint PreviousA = HintTileA;
+	const FIntPoint PreviousB = HintTileB;
+
 	bHasHintTiles = bHasHint;
 	HintTileA = First;
 	HintTileB = Second;
-	RefreshAllTiles();
+
+	if (bHadHintTiles)
+	{
+		RefreshTile(PreviousA.X, PreviousA.Y);
+		RefreshTile(PreviousB.X, PreviousB.Y);
+	}
+	if (bHasHintTiles)
+	{
+		RefreshTile(HintTileA.X, HintTileA.Y);
+		RefreshTile(HintTileB.X, HintTileB.Y);
+	}
 }
 
 void UOnetBoardWidget::HandleWildStateChanged(bool bWildReady)
@@ -456,10 +594,11 @@ UOnetTileWidget* UOnetBoardWidget::GetTileWidgetAt(int32 X, int32 Y) const
 	return TileWidgets[Index];
 }
 
-void UOnetBoardWidget::DrawConnectionPath(const TArray<FIntPoint>& Path)
+void UOnetBoardWidget::DrawConnectionPath(const TConstArrayView<FIntPoint> Path)
 {
 	// Clear previous path.
-	ActivePathGridPoints = Path;
+	ActivePathGridPoints.Reset();
+	ActivePathGridPoints.Append(Path.GetData(), Path.Num());
 
 	// Start displaying the path.
 	bShowPath = ActivePathGridPoints.Num() >= 2;
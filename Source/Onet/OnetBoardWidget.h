@@ -126,6 +126,9 @@ private:
 	FIntPoint HintTileA = FIntPoint(-1, -1);
 	FIntPoint HintTileB = FIntPoint(-1, -1);
 
+	// Partner highlight state (one bit per logical cell, Y * Width + X).
+	TBitArray<> PartnerTiles;
+
 	// Cached action state.
 	int32 CachedRemainingShuffles = 0;
 	int32 CachedMaxShuffles = 0;
@@ -138,11 +141,12 @@ private:
 
 private:
 	void RefreshAllTiles();
+	void RefreshTile(int32 X, int32 Y);
 	void UpdateActionButtons();
 	void ShowCompletionScreen();
 
 	// Draw the connection path (called from C++, not Blueprint).
-	void DrawConnectionPath(const TArray<FIntPoint>& Path);
+	void DrawConnectionPath(TConstArrayView<FIntPoint> Path);
 
 	// Clear the path after display duration.
 	void ClearPath();
@@ -153,17 +157,22 @@ private:
 	// Derive origin and per-cell step in local space (supports outer padding coords).
 	bool ComputeGridMetrics(FVector2D& OutOrigin, FVector2D& OutStep) const;
 
-	UFUNCTION()
-	void HandleBoardChanged();
-
-	UFUNCTION()
-	void HandleSelectionChanged(const bool bHasFirstSelection, const FIntPoint FirstSelection);
-
-	UFUNCTION()
-	void HandleMatchSuccessful(const TArray<FIntPoint>& Path);
+	// Subscribe to / unsubscribe from the native board events.
+	void BindBoardEvents();
+	void UnbindBoardEvents();
 
-	UFUNCTION()
+	// Board event handlers (bound to the component's native delegates).
+	void HandleBoardChanged();
+	void HandleCellsChanged(EOnetCellChangeKind Kind, TConstArrayView<FIntPoint> Cells);
+	void HandleSelectionChanged(bool bHasFirstSelection, const FIntPoint& FirstSelection);
+	void HandleSelectionPartnersChanged(TConstArrayView<FIntPoint> Partners);
+	void HandleMatchSuccessful(TConstArrayView<FIntPoint> Path);
 	void HandleMatchFailed();
+	void HandleShuffleUpdated(int32 RemainingUses, bool bAutoTriggered);
+	void HandleHintUpdated(bool bHasHint, const FIntPoint& First, const FIntPoint& Second);
+	void HandleWildStateChanged(bool bWildReady);
+	void HandleBoardCleared();
+	void HandleNoMovesRemain();
 
 	UFUNCTION()
 	void HandleShuffleClicked();
@@ -173,19 +182,4 @@ private:
 
 	UFUNCTION()
 	void HandleHintClicked();
-
-	UFUNCTION()
-	void HandleShuffleUpdated(int32 RemainingUses, bool bAutoTriggered);
-
-	UFUNCTION()
-	void HandleHintUpdated(bool bHasHint, FIntPoint First, FIntPoint Second);
-
-	UFUNCTION()
-	void HandleWildStateChanged(bool bWildReady);
-
-	UFUNCTION()
-	void HandleBoardCleared();
-
-	UFUNCTION()
-	void HandleNoMovesRemain();
 };
\ No newline at end of file
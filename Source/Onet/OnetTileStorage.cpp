@@ -0,0 +1,94 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetTileStorage.h"
+
+void FOnetTileStorage::Reset(const int32 InWidth, const int32 InHeight, const int32 NumTypes, const bool bInChunked)
+{
+	check(NumTypes <= MaxTypes);
+
+	Width = InWidth;
+	Height = InHeight;
+	bWide = NumTypes > EmptyNarrow;
+	bChunked = bInChunked;
+
+	// Chunked storage rounds both sides up to whole chunks; the extra cells simply stay empty.
+	int32 NumSlots = Width * Height;
+	ChunkTileCounts.Reset();
+	if (bChunked)
+	{
+		ChunksX = (Width + ChunkMask) >> ChunkBits;
+		ChunksY = (Height + ChunkMask) >> ChunkBits;
+		NumSlots = (ChunksX * ChunksY) << ChunkShift;
+		ChunkTileCounts.SetNumZeroed(ChunksX * ChunksY);
+	}
+	else
+	{
+		ChunksX = 0;
+		ChunksY = 0;
+	}
+
+	if (bWide)
+	{
+		Narrow.Empty();
+		Wide.SetNumUninitialized(NumSlots);
+		for (uint16& Value : Wide)
+		{
+			Value = EmptyWide;
+		}
+	}
+	else
+	{
+		Wide.Empty();
+		Narrow.SetNumUninitialized(NumSlots);
+		FMemory::Memset(Narrow.GetData(), EmptyNarrow, NumSlots);
+	}
+}
+
+void FOnetTileStorage::ForEachTile(const TFunctionRef<void(int32, int32, int32)> Visit) const
+{
+	if (!bChunked)
+	{
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const int32 Type = ReadSlot(Y * Width + X);
+				if (Type != INDEX_NONE)
+				{
+					Visit(X, Y, Type);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 Chunk = 0; Chunk < ChunkTileCounts.Num(); ++Chunk)
+	{
+		if (ChunkTileCounts[Chunk] == 0)
+		{
+			continue;
+		}
+
+		const int32 OriginX = (Chunk % ChunksX) << ChunkBits;
+		const int32 OriginY = (Chunk / ChunksX) << ChunkBits;
+		for (int32 Code = 0; Code < (1 << ChunkShift); ++Code)
+		{
+			const int32 Type = ReadSlot((Chunk << ChunkShift) | Code);
+			if (Type == INDEX_NONE)
+			{
+				continue;
+			}
+
+			// De-interleave the Morton code back into chunk-local coordinates.
+			int32 LocalX = 0;
+			int32 LocalY = 0;
+			for (int32 Bit = 0; Bit < ChunkBits; ++Bit)
+			{
+				LocalX |= ((Code >> (2 * Bit)) & 1) << Bit;
+				LocalY |= ((Code >> (2 * Bit + 1)) & 1) << Bit;
+			}
+			Visit(OriginX + LocalX, OriginY + LocalY, Type);
+		}
+	}
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnetBoardTypes.h"
+
+/**
+ * Packed tile types of the padded board, one entry per physical cell.
+ *
+ * A cell stores only its type id; the largest value of the encoding marks an empty cell, so
+ * emptiness costs no extra byte. Boards with fewer than 255 tile types use one byte per cell,
+ * anything up to MaxTypes uses two (an FOnetTile is eight). Scans over the board therefore touch
+ * a quarter (or an eighth) of the memory, and large boards stay cache resident.
+ *
+ * Two layouts:
+ * - Flat: row-major, Index = Y * Width + X.
+ * - Chunked: 8x8 chunks in row-major chunk order, cells Morton-ordered inside a chunk, so a chunk
+ *   is one cache line (narrow encoding) and neighbours in both directions share it. Every chunk
+ *   counts its tiles, and ForEachTile skips empty chunks, so scans of a sparse huge board only
+ *   pay for the chunks that still hold tiles.
+ * Cells are addressed by physical (X, Y) or by row-major index in both layouts.
+ *
+ * FOnetTile is only built at the API boundary (GetTile); everything inside the board core reads
+ * the packed types directly.
+ */
+struct ONET_API FOnetTileStorage
+{
+	// Largest number of distinct tile types the wide encoding can hold.
+	static constexpr int32 MaxTypes = MAX_uint16;
+
+	// Resize to InWidth x InHeight empty cells, with the narrowest encoding that holds NumTypes types.
+	void Reset(int32 InWidth, int32 InHeight, int32 NumTypes, bool bInChunked);
+
+	int32 Num() const { return Width * Height; }
+	bool IsChunked() const { return bChunked; }
+
+	// Bytes per cell of the current encoding (1 or 2).
+	int32 GetBytesPerCell() const { return bWide ? 2 : 1; }
+
+	// Tile type of a cell, INDEX_NONE if the cell is empty.
+	int32 GetType(const int32 X, const int32 Y) const
+	{
+		return ReadSlot(GetSlot(X, Y));
+	}
+
+	int32 GetType(const int32 Cell) const
+	{
+		return bChunked ? GetType(Cell % Width, Cell / Width) : ReadSlot(Cell);
+	}
+
+	bool IsEmpty(const int32 Cell) const
+	{
+		return GetType(Cell) == INDEX_NONE;
+	}
+
+	// Place a tile of Type (0 <= Type < the NumTypes given to Reset), or empty the cell with INDEX_NONE.
+	void SetType(const int32 X, const int32 Y, const int32 Type)
+	{
+		const int32 Slot = GetSlot(X, Y);
+		if (bChunked)
+		{
+			const bool bWasOccupied = ReadSlot(Slot) != INDEX_NONE;
+			const bool bOccupied = Type != INDEX_NONE;
+			if (bOccupied && !bWasOccupied)
+			{
+				++ChunkTileCounts[Slot >> ChunkShift];
+			}
+			else if (!bOccupied && bWasOccupied)
+			{
+				--ChunkTileCounts[Slot >> ChunkShift];
+			}
+		}
+		WriteSlot(Slot, Type);
+	}
+
+	void SetType(const int32 Cell, const int32 Type)
+	{
+		if (bChunked)
+		{
+			SetType(Cell % Width, Cell / Width, Type);
+		}
+		else
+		{
+			WriteSlot(Cell, Type);
+		}
+	}
+
+	// Blueprint-facing view of a cell.
+	FOnetTile GetTile(const int32 Cell) const
+	{
+		FOnetTile Tile;
+		Tile.TileTypeId = GetType(Cell);
+		Tile.bEmpty = Tile.TileTypeId == INDEX_NONE;
+		return Tile;
+	}
+
+	// Call Visit(X, Y, Type) for every occupied cell, in storage order.
+	void ForEachTile(TFunctionRef<void(int32, int32, int32)> Visit) const;
+
+private:
+	static constexpr uint8 EmptyNarrow = MAX_uint8;
+	static constexpr uint16 EmptyWide = MAX_uint16;
+
+	// Chunks are (1 << ChunkBits) cells on a side.
+	static constexpr int32 ChunkBits = 3;
+	static constexpr int32 ChunkSide = 1 << ChunkBits;
+	static constexpr int32 ChunkShift = 2 * ChunkBits;
+	static constexpr int32 ChunkMask = ChunkSide - 1;
+
+	// Physical dimensions.
+	int32 Width = 0;
+	int32 Height = 0;
+
+	bool bWide = false;
+	bool bChunked = false;
+
+	// Chunk grid (chunked layout only) and the number of tiles in every chunk.
+	int32 ChunksX = 0;
+	int32 ChunksY = 0;
+	TArray<uint16> ChunkTileCounts;
+
+	// Only the array of the active encoding is allocated.
+	TArray<uint8> Narrow;
+	TArray<uint16> Wide;
+
+	// Storage position of a cell.
+	int32 GetSlot(const int32 X, const int32 Y) const
+	{
+		if (!bChunked)
+		{
+			return Y * Width + X;
+		}
+
+		const int32 Chunk = (Y >> ChunkBits) * ChunksX + (X >> ChunkBits);
+		return (Chunk << ChunkShift) | InterleaveBits(X & ChunkMask, Y & ChunkMask);
+	}
+
+	int32 ReadSlot(const int32 Slot) const
+	{
+		if (bWide)
+		{
+			const uint16 Value = Wide[Slot];
+			return Value == EmptyWide ? INDEX_NONE : Value;
+		}
+
+		const uint8 Value = Narrow[Slot];
+		return Value == EmptyNarrow ? INDEX_NONE : Value;
+	}
+
+	void WriteSlot(const int32 Slot, const int32 Type)
+	{
+		if (bWide)
+		{
+			checkSlow(Type >= INDEX_NONE && Type < EmptyWide);
+			Wide[Slot] = Type == INDEX_NONE ? EmptyWide : static_cast<uint16>(Type);
+		}
+		else
+		{
+			checkSlow(Type >= INDEX_NONE && Type < EmptyNarrow);
+			Narrow[Slot] = Type == INDEX_NONE ? EmptyNarrow : static_cast<uint8>(Type);
+		}
+	}
+
+	// Morton code of a cell inside its chunk: X bits on even positions, Y bits on odd ones.
+	static int32 InterleaveBits(const int32 X, const int32 Y)
+	{
+		int32 Code = 0;
+		for (int32 Bit = 0; Bit < ChunkBits; ++Bit)
+		{
+			Code |= ((X >> Bit) & 1) << (2 * Bit);
+			Code |= ((Y >> Bit) & 1) << (2 * Bit + 1);
+		}
+		return Code;
+	}
+};
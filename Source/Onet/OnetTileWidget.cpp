@@ -59,9 +59,11 @@ void UOnetTileWidget::HandleButtonClicked()
  * @param bIsEmpty - Whether the tile is empty.
  * @param TileTypeId - The type identifier of the tile.
  * @param bIsSelected - Whether the tile is currently selected.
+ * @param bIsHint - Whether the tile is part of the current hint pair.
+ * @param bIsPartner - Whether the current selection can be linked to this tile.
  */
 void UOnetTileWidget::SetTileVisual(const bool bIsEmpty, const int32 TileTypeId, bool bIsSelected,
-                                    const bool bIsHint) const
+                                    const bool bIsHint, const bool bIsPartner) const
 {
 	// Hide empty tiles completely.
 	if (bIsEmpty)
@@ -83,7 +85,12 @@ void UOnetTileWidget::SetTileVisual(const bool bIsEmpty, const int32 TileTypeId,
 		if (!bIsEmpty)
 		{
 			const bool bUseHintColor = bIsHint && !bIsSelected;
-			TileButton->SetBackgroundColor(bIsSelected ? SelectedColor : (bUseHintColor ? HintColor : NormalColor));
+			const bool bUsePartnerColor = bIsPartner && !bIsSelected && !bIsHint;
+			TileButton->SetBackgroundColor(bIsSelected
+				                               ? SelectedColor
+				                               : (bUseHintColor
+					                                  ? HintColor
+					                                  : (bUsePartnerColor ? PartnerColor : NormalColor)));
 		}
 	}
 
@@ -33,7 +33,8 @@ public:
 
 	// Update visuals based on board data.
 	UFUNCTION(BlueprintCallable, Category = "Onet|Tile")
-	void SetTileVisual(bool bIsEmpty, int32 TileTypeId, bool bIsSelected, bool bIsHint) const;
+	void SetTileVisual(bool bIsEmpty, int32 TileTypeId, bool bIsSelected, bool bIsHint,
+	                   bool bIsPartner = false) const;
 
 	// UI event for parent widget to subscribe to.
 	UPROPERTY(BlueprintAssignable, Category="Onet|Events")
@@ -68,6 +69,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Onet|Tile")
 	FLinearColor HintColor = FLinearColor(0.5f, 0.8f, 1.0f, 1.0f);
 
+	// Tiles the current selection can be linked to.
+	UPROPERTY(EditDefaultsOnly, Category = "Onet|Tile")
+	FLinearColor PartnerColor = FLinearColor(0.6f, 1.0f, 0.6f, 1.0f);
+
 	int32 X = -1;
 	int32 Y = -1;
 
@@ -0,0 +1,79 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "OnetTypeBuckets.h"
+
+/**
+ * Rebuild every bucket.
+ *
+ * @param CellTypes - Type of each cell, INDEX_NONE for empty cells.
+ */
+void FOnetTypeBuckets::Rebuild(const TConstArrayView<int32> CellTypes)
+{
+	int32 NumTypes = 0;
+	for (const int32 Type : CellTypes)
+	{
+		NumTypes = FMath::Max(NumTypes, Type + 1);
+	}
+
+	Counts.Reset();
+	Counts.SetNumZeroed(NumTypes);
+	Offsets.Reset();
+	Offsets.SetNumZeroed(NumTypes);
+	CellType.Reset();
+	CellType.Init(INDEX_NONE, CellTypes.Num());
+	CellSlot.Reset();
+	CellSlot.Init(INDEX_NONE, CellTypes.Num());
+
+	int32 NumOccupied = 0;
+	for (const int32 Type : CellTypes)
+	{
+		if (Type >= 0)
+		{
+			++Counts[Type];
+			++NumOccupied;
+		}
+	}
+
+	for (int32 Type = 1; Type < NumTypes; ++Type)
+	{
+		Offsets[Type] = Offsets[Type - 1] + Counts[Type - 1];
+	}
+
+	// Second pass places cells; Counts doubles as the fill cursor and ends up where it started.
+	Buffer.SetNumUninitialized(NumOccupied);
+	FMemory::Memzero(Counts.GetData(), Counts.Num() * sizeof(int32));
+	for (int32 Cell = 0; Cell < CellTypes.Num(); ++Cell)
+	{
+		const int32 Type = CellTypes[Cell];
+		if (Type >= 0)
+		{
+			const int32 Slot = Offsets[Type] + Counts[Type]++;
+			Buffer[Slot] = Cell;
+			CellType[Cell] = Type;
+			CellSlot[Cell] = Slot;
+		}
+	}
+}
+
+void FOnetTypeBuckets::Remove(const int32 Cell)
+{
+	if (!CellSlot.IsValidIndex(Cell) || CellSlot[Cell] == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Swap the last live cell of the span into the freed slot.
+	const int32 Type = CellType[Cell];
+	const int32 Slot = CellSlot[Cell];
+	const int32 LastSlot = Offsets[Type] + Counts[Type] - 1;
+	const int32 LastCell = Buffer[LastSlot];
+
+	Buffer[Slot] = LastCell;
+	CellSlot[LastCell] = Slot;
+	Buffer[LastSlot] = Cell;
+
+	CellSlot[Cell] = INDEX_NONE;
+	CellType[Cell] = INDEX_NONE;
+	--Counts[Type];
+}
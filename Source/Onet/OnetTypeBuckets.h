@@ -0,0 +1,49 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Flat per-type position buckets.
+ *
+ * All occupied cells live in one contiguous buffer, sorted by tile type, so every type is a
+ * dense span [Offsets[Type], Offsets[Type] + Counts[Type]). A reverse lookup (cell -> slot)
+ * lets a cleared cell be swapped out of its span in O(1).
+ *
+ * Cells are plain indices (the board uses physical indices). Rebuilt only when the board is
+ * repopulated; removals patch it in place.
+ */
+struct ONET_API FOnetTypeBuckets
+{
+	// Rebuild from a per-cell type array (INDEX_NONE = empty cell). Counting sort, O(cells + types).
+	void Rebuild(TConstArrayView<int32> CellTypes);
+
+	// Remove an occupied cell from its bucket. No-op if the cell is not bucketed.
+	void Remove(int32 Cell);
+
+	// Occupied cells of a type (unordered after removals).
+	TConstArrayView<int32> GetCells(const int32 Type) const
+	{
+		if (!Counts.IsValidIndex(Type))
+		{
+			return TConstArrayView<int32>();
+		}
+		return TConstArrayView<int32>(Buffer.GetData() + Offsets[Type], Counts[Type]);
+	}
+
+	// Number of type ids covered (max type id + 1).
+	int32 GetNumTypes() const { return Counts.Num(); }
+
+private:
+	// Occupied cells grouped by type.
+	TArray<int32> Buffer;
+
+	// Start of each type's span in Buffer, and how many cells of the span are still live.
+	TArray<int32> Offsets;
+	TArray<int32> Counts;
+
+	// Type and slot in Buffer of every cell (INDEX_NONE if not bucketed).
+	TArray<int32> CellType;
+	TArray<int32> CellSlot;
+};
@@ -0,0 +1,293 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+
+#include "SOnetBoardView.h"
+#include "OnetBoardComponent.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "InputCoreTypes.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+void SOnetBoardView::Construct(const FArguments& InArgs)
+{
+	Board = InArgs._Board;
+	TileSize = FMath::Max(1.0f, InArgs._TileSize);
+	TilePadding = FMath::Max(0.0f, InArgs._TilePadding);
+
+	NormalColor = InArgs._NormalColor;
+	SelectedColor = InArgs._SelectedColor;
+	HintColor = InArgs._HintColor;
+	PartnerColor = InArgs._PartnerColor;
+	LabelColor = InArgs._LabelColor;
+	PathColor = InArgs._PathColor;
+	PathThickness = InArgs._PathThickness;
+
+	Font = InArgs._Font.IsSet() ? InArgs._Font.GetValue() : FCoreStyle::GetDefaultFontStyle("Regular", 10);
+	TileBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+
+	OnCellClicked = InArgs._OnCellClicked;
+	LaidOutSize = GetBoardSize();
+	CacheTypeLabels();
+}
+
+void SOnetBoardView::SetBoard(const TWeakObjectPtr<UOnetBoardComponent>& InBoard)
+{
+	Board = InBoard;
+	PartnerCells.Reset();
+	RefreshBoard();
+}
+
+void SOnetBoardView::SetSelection(const bool bInHasSelection, const FIntPoint& InSelection)
+{
+	bHasSelection = bInHasSelection;
+	Selection = InSelection;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SOnetBoardView::SetHint(const bool bInHasHint, const FIntPoint& InFirst, const FIntPoint& InSecond)
+{
+	bHasHint = bInHasHint;
+	HintFirst = InFirst;
+	HintSecond = InSecond;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SOnetBoardView::SetPartners(const TConstArrayView<FIntPoint> Partners)
+{
+	const FIntPoint Size = GetBoardSize();
+	PartnerCells.Init(false, Size.X * Size.Y);
+	for (const FIntPoint& Partner : Partners)
+	{
+		if (Partner.X >= 0 && Partner.X < Size.X && Partner.Y >= 0 && Partner.Y < Size.Y)
+		{
+			PartnerCells[Partner.Y * Size.X + Partner.X] = true;
+		}
+	}
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SOnetBoardView::ShowPath(const TConstArrayView<FIntPoint> Path, const float Duration)
+{
+	ClearPath();
+	if (Path.Num() < 2)
+	{
+		return;
+	}
+
+	PathCells.Append(Path.GetData(), Path.Num());
+	PathTimer = RegisterActiveTimer(FMath::Max(Duration, 0.0f), FWidgetActiveTimerDelegate::CreateLambda(
+		                                [this](double, float)
+		                                {
+			                                PathTimer.Reset();
+			                                ClearPath();
+			                                return EActiveTimerReturnType::Stop;
+		                                }));
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SOnetBoardView::ClearPath()
+{
+	if (const TSharedPtr<FActiveTimerHandle> Timer = PathTimer)
+	{
+		PathTimer.Reset();
+		UnRegisterActiveTimer(Timer.ToSharedRef());
+	}
+
+	if (PathCells.Num() > 0)
+	{
+		PathCells.Reset();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SOnetBoardView::RefreshBoard()
+{
+	CacheTypeLabels();
+
+	const FIntPoint Size = GetBoardSize();
+	if (Size != LaidOutSize)
+	{
+		LaidOutSize = Size;
+		Invalidate(EInvalidateWidgetReason::Layout);
+		return;
+	}
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+FIntPoint SOnetBoardView::GetBoardSize() const
+{
+	const UOnetBoardComponent* BoardComponent = Board.Get();
+	return BoardComponent
+		       ? FIntPoint(BoardComponent->GetBoardWidth(), BoardComponent->GetBoardHeight())
+		       : FIntPoint::ZeroValue;
+}
+
+void SOnetBoardView::CacheTypeLabels()
+{
+	// A type's label never changes, so the cache only ever grows.
+	const UOnetBoardComponent* BoardComponent = Board.Get();
+	const int32 NumTypes = BoardComponent ? BoardComponent->GetNumTileTypes() : 0;
+	for (int32 Type = TypeLabels.Num(); Type < NumTypes; ++Type)
+	{
+		TypeLabels.Add(FString::FromInt(Type));
+	}
+}
+
+bool SOnetBoardView::ComputeGridMetrics(const FGeometry& Geometry, FVector2D& OutOrigin, float& OutStep) const
+{
+	const FIntPoint Size = GetBoardSize();
+	const FVector2D LocalSize = Geometry.GetLocalSize();
+	if (Size.X <= 0 || Size.Y <= 0 || LocalSize.X <= 0.0 || LocalSize.Y <= 0.0)
+	{
+		return false;
+	}
+
+	OutStep = static_cast<float>(FMath::Min(LocalSize.X / Size.X, LocalSize.Y / Size.Y));
+	OutOrigin = (LocalSize - FVector2D(Size.X, Size.Y) * OutStep) * 0.5;
+	return OutStep > 0.0f;
+}
+
+bool SOnetBoardView::GetCellAt(const FGeometry& Geometry, const FVector2D& LocalPosition, FIntPoint& OutCell) const
+{
+	OutCell = FIntPoint(-1, -1);
+
+	FVector2D Origin;
+	float Step;
+	if (!ComputeGridMetrics(Geometry, Origin, Step))
+	{
+		return false;
+	}
+
+	const FVector2D GridPosition = (LocalPosition - Origin) / Step;
+	const FIntPoint Cell(FMath::FloorToInt32(GridPosition.X), FMath::FloorToInt32(GridPosition.Y));
+	const FIntPoint Size = GetBoardSize();
+	if (Cell.X < 0 || Cell.X >= Size.X || Cell.Y < 0 || Cell.Y >= Size.Y)
+	{
+		return false;
+	}
+
+	// The padding around a tile belongs to no tile, like the gaps of the grid panel.
+	const float PaddingFraction = TilePadding / (TileSize + TilePadding * 2.0f);
+	const FVector2D InCell = GridPosition - FVector2D(Cell.X, Cell.Y);
+	if (InCell.X < PaddingFraction || InCell.X > 1.0f - PaddingFraction ||
+		InCell.Y < PaddingFraction || InCell.Y > 1.0f - PaddingFraction)
+	{
+		return false;
+	}
+
+	OutCell = Cell;
+	return true;
+}
+
+FVector2D SOnetBoardView::ComputeDesiredSize(float) const
+{
+	const FIntPoint Size = GetBoardSize();
+	return FVector2D(Size.X, Size.Y) * (TileSize + TilePadding * 2.0f);
+}
+
+/**
+ * Paint the tiles inside the culling rect: boxes on LayerId, labels on LayerId + 1, the
+ * connection path on LayerId + 2. Labels are skipped once tiles get too small to read.
+ */
+int32 SOnetBoardView::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+                              const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
+                              const int32 LayerId, const FWidgetStyle& InWidgetStyle, const bool bParentEnabled) const
+{
+	const UOnetBoardComponent* BoardComponent = Board.Get();
+
+	FVector2D Origin;
+	float Step;
+	if (!BoardComponent || !ComputeGridMetrics(AllottedGeometry, Origin, Step))
+	{
+		return LayerId;
+	}
+
+	const FIntPoint Size = GetBoardSize();
+	const FVector2f GridOrigin(Origin);
+	const float Padding = Step * TilePadding / (TileSize + TilePadding * 2.0f);
+	const FVector2f BoxSize(Step - Padding * 2.0f, Step - Padding * 2.0f);
+
+	// Visible cell range, from the culling rect in local space.
+	const FVector2D CullMin = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft());
+	const FVector2D CullMax = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight());
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt32((CullMin.X - Origin.X) / Step), 0, Size.X - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt32((CullMin.Y - Origin.Y) / Step), 0, Size.Y - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt32((CullMax.X - Origin.X) / Step), 0, Size.X - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt32((CullMax.Y - Origin.Y) / Step), 0, Size.Y - 1);
+
+	// Labels need a few pixels of text height to be worth their draw elements.
+	const float PixelsPerUnit = AllottedGeometry.Scale;
+	const bool bDrawLabels = BoxSize.Y * PixelsPerUnit >= 12.0f;
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const FVector2f DigitSize = bDrawLabels ? FVector2f(FontMeasure->Measure(TEXT("0"), Font)) : FVector2f::ZeroVector;
+
+	const ESlateDrawEffect DrawEffect = ShouldBeEnabled(bParentEnabled)
+		                                    ? ESlateDrawEffect::None
+		                                    : ESlateDrawEffect::DisabledEffect;
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			FOnetTile Tile;
+			if (!BoardComponent->GetTile(X, Y, Tile) || Tile.bEmpty)
+			{
+				continue;
+			}
+
+			const FIntPoint Cell(X, Y);
+			const bool bIsSelected = bHasSelection && Cell == Selection;
+			const bool bIsHint = bHasHint && (Cell == HintFirst || Cell == HintSecond);
+			const bool bIsPartner = PartnerCells.IsValidIndex(Y * Size.X + X) && PartnerCells[Y * Size.X + X];
+			const FLinearColor& Color = bIsSelected
+				                            ? SelectedColor
+				                            : (bIsHint ? HintColor : (bIsPartner ? PartnerColor : NormalColor));
+
+			const FVector2f BoxOffset = GridOrigin + FVector2f(X * Step + Padding, Y * Step + Padding);
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+			                           AllottedGeometry.ToPaintGeometry(BoxSize, FSlateLayoutTransform(BoxOffset)),
+			                           TileBrush, DrawEffect, Color * InWidgetStyle.GetColorAndOpacityTint());
+
+			if (bDrawLabels && TypeLabels.IsValidIndex(Tile.TileTypeId))
+			{
+				// Show the type id, like the tile widget's debug label.
+				const FString& Label = TypeLabels[Tile.TileTypeId];
+				const FVector2f LabelSize(DigitSize.X * Label.Len(), DigitSize.Y);
+				const FVector2f LabelOffset = BoxOffset + (BoxSize - LabelSize) * 0.5f;
+				FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1,
+				                            AllottedGeometry.ToPaintGeometry(LabelSize, FSlateLayoutTransform(LabelOffset)),
+				                            Label, Font, DrawEffect, LabelColor * InWidgetStyle.GetColorAndOpacityTint());
+			}
+		}
+	}
+
+	if (PathCells.Num() >= 2)
+	{
+		TArray<FVector2D> LinePoints;
+		LinePoints.Reserve(PathCells.Num());
+		for (const FIntPoint& Cell : PathCells)
+		{
+			LinePoints.Add(Origin + FVector2D(Cell.X + 0.5, Cell.Y + 0.5) * Step);
+		}
+
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), LinePoints,
+		                             DrawEffect, PathColor, true, PathThickness);
+	}
+
+	return LayerId + 2;
+}
+
+FReply SOnetBoardView::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+	{
+		return FReply::Unhandled();
+	}
+
+	FIntPoint Cell;
+	GetCellAt(MyGeometry, MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()), Cell);
+	OnCellClicked.ExecuteIfBound(Cell);
+	return FReply::Handled();
+}
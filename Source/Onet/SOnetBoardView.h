@@ -0,0 +1,132 @@
+// Copyright 2026 Xinchen Shen. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class UOnetBoardComponent;
+
+// Clicked cell in logical coordinates; (-1, -1) when the click hit no tile.
+DECLARE_DELEGATE_OneParam(FOnetBoardViewCellClicked, FIntPoint);
+
+/**
+ * Whole Onet board as one Slate leaf widget.
+ *
+ * Instead of a button and a text block per cell, OnPaint emits one box and one label per visible
+ * tile (boxes on one layer and labels on the next, so Slate batches them), and clicks are mapped
+ * to cells from the grid metrics. Widget count, layout cost and memory stay constant whatever the
+ * board size; the draw elements scale with the tiles on screen only.
+ *
+ * Reads tiles straight from the board component while painting. Highlight state is pushed in by
+ * the owner (see UOnetBoardView), and every setter invalidates the paint.
+ */
+class ONET_API SOnetBoardView : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SOnetBoardView)
+			: _TileSize(32.0f)
+			  , _TilePadding(2.0f)
+			  , _NormalColor(FLinearColor::White)
+			  , _SelectedColor(FLinearColor(1.0f, 1.0f, 0.0f, 1.0f))
+			  , _HintColor(FLinearColor(0.5f, 0.8f, 1.0f, 1.0f))
+			  , _PartnerColor(FLinearColor(0.6f, 1.0f, 0.6f, 1.0f))
+			  , _LabelColor(FLinearColor::Black)
+			  , _PathColor(FLinearColor::Green)
+			  , _PathThickness(4.0f)
+		{
+		}
+
+		SLATE_ARGUMENT(TWeakObjectPtr<UOnetBoardComponent>, Board)
+
+		// Desired size of one tile and the gap on each of its sides, in slate units.
+		// The board is scaled to fit the allotted geometry.
+		SLATE_ARGUMENT(float, TileSize)
+		SLATE_ARGUMENT(float, TilePadding)
+
+		SLATE_ARGUMENT(FLinearColor, NormalColor)
+		SLATE_ARGUMENT(FLinearColor, SelectedColor)
+		SLATE_ARGUMENT(FLinearColor, HintColor)
+		SLATE_ARGUMENT(FLinearColor, PartnerColor)
+		SLATE_ARGUMENT(FLinearColor, LabelColor)
+		SLATE_ARGUMENT(FLinearColor, PathColor)
+		SLATE_ARGUMENT(float, PathThickness)
+
+		// Font of the tile type labels (defaults to the core style's normal font).
+		SLATE_ARGUMENT(TOptional<FSlateFontInfo>, Font)
+
+		SLATE_EVENT(FOnetBoardViewCellClicked, OnCellClicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetBoard(const TWeakObjectPtr<UOnetBoardComponent>& InBoard);
+
+	// Highlight state (logical coordinates).
+	void SetSelection(bool bInHasSelection, const FIntPoint& InSelection);
+	void SetHint(bool bInHasHint, const FIntPoint& InFirst, const FIntPoint& InSecond);
+	void SetPartners(TConstArrayView<FIntPoint> Partners);
+
+	// Draw a connection path for Duration seconds (cell centers, logical coordinates; may leave the board by one cell).
+	void ShowPath(TConstArrayView<FIntPoint> Path, float Duration);
+	void ClearPath();
+
+	// Repaint after the board changed. Only a change of dimensions needs a new layout.
+	void RefreshBoard();
+
+	// Logical cell of the tile under LocalPosition. False if it lies between tiles or off the board.
+	bool GetCellAt(const FGeometry& Geometry, const FVector2D& LocalPosition, FIntPoint& OutCell) const;
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	                      FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	                      bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+private:
+	TWeakObjectPtr<UOnetBoardComponent> Board;
+
+	float TileSize = 32.0f;
+	float TilePadding = 2.0f;
+
+	FLinearColor NormalColor;
+	FLinearColor SelectedColor;
+	FLinearColor HintColor;
+	FLinearColor PartnerColor;
+	FLinearColor LabelColor;
+	FLinearColor PathColor;
+	float PathThickness = 4.0f;
+
+	FSlateFontInfo Font;
+	const FSlateBrush* TileBrush = nullptr;
+
+	FOnetBoardViewCellClicked OnCellClicked;
+
+	// Board dimensions at the last layout.
+	FIntPoint LaidOutSize = FIntPoint::ZeroValue;
+
+	// Label text per tile type id, so painting allocates no strings.
+	TArray<FString> TypeLabels;
+
+	bool bHasSelection = false;
+	FIntPoint Selection = FIntPoint(-1, -1);
+
+	bool bHasHint = false;
+	FIntPoint HintFirst = FIntPoint(-1, -1);
+	FIntPoint HintSecond = FIntPoint(-1, -1);
+
+	// One bit per logical cell (Y * Width + X).
+	TBitArray<> PartnerCells;
+
+	TArray<FIntPoint> PathCells;
+	TSharedPtr<FActiveTimerHandle> PathTimer;
+
+	FIntPoint GetBoardSize() const;
+
+	// Add labels for type ids the board uses but TypeLabels does not cover yet.
+	void CacheTypeLabels();
+
+	// Local position of cell (0, 0)'s top-left corner and the distance between two cells, with the
+	// board scaled uniformly to fit and centered in the geometry.
+	bool ComputeGridMetrics(const FGeometry& Geometry, FVector2D& OutOrigin, float& OutStep) const;
+};